@@ -0,0 +1,239 @@
+#include "CNN.h"
+
+#define CNN_MIN(a, b) ((a) < (b) ? (a) : (b))
+
+#if CNN_FC_ACCUMULATORS < 1 || (CNN_FC_ACCUMULATORS & (CNN_FC_ACCUMULATORS - 1)) != 0
+#error "CNN_FC_ACCUMULATORS must be a power of two"
+#endif
+
+static float relu(float x) {
+    #pragma HLS INLINE
+    return x > 0 ? x : 0;
+}
+
+// Generates <layer>_layer() for a convolution: reads the source map from in, writes its output
+// map to out, both in (h, w, c) order in external memory.
+// The output is computed one tile of TR rows x TOC channels at a time. For each tile, the input
+// channels are loaded TIC at a time together with the matching weights, and accumulated into the
+// tile: only the tiles are on chip. The products of an output are added in (ic, kh, kw) order after
+// the bias, the same order as the fixed pipeline of ConvNet.c, so both give identical results.
+#define CNN_CONV_KERNEL(name, source, in_ch, out_ch, kernel, stride, padding, activation)              \
+    _Static_assert((in_ch) == CNN_##source##_C, #name ": in_channels does not match " #source);         \
+    static void name##_layer(const float *in, float *out, const CNN *net) {                            \
+        _Pragma("HLS INLINE off")                                                                       \
+        enum {                                                                                          \
+            H_IN = CNN_##source##_H, W_IN = CNN_##source##_W,                                           \
+            H_OUT = CNN_##name##_H, W_OUT = CNN_##name##_W,                                             \
+            TR = CNN_MIN(CNN_TILE_ROWS, H_OUT),                                                         \
+            TOC = CNN_MIN(CNN_TILE_OC, out_ch),                                                         \
+            TIC = CNN_MIN(CNN_TILE_IC, in_ch),                                                          \
+            IN_ROWS = (TR - 1) * (stride) + (kernel),                                                   \
+            IN_COLS = W_IN + 2 * (padding)                                                              \
+        };                                                                                              \
+        float in_tile[TIC][IN_ROWS][IN_COLS];                                                           \
+        float w_tile[TOC][TIC][kernel][kernel];                                                         \
+        float acc[TOC][TR][W_OUT];                                                                      \
+        _Pragma("HLS ARRAY_PARTITION variable=in_tile complete dim=1")                                  \
+        _Pragma("HLS ARRAY_PARTITION variable=w_tile complete dim=0")                                   \
+        _Pragma("HLS ARRAY_PARTITION variable=acc complete dim=1")                                      \
+                                                                                                        \
+        row_tiles: for (int r0 = 0; r0 < H_OUT; r0 += TR) {                                             \
+            oc_tiles: for (int oc0 = 0; oc0 < (out_ch); oc0 += TOC) {                                   \
+                /* Initialize with the biases */                                                        \
+                for (int r = 0; r < TR; r++) {                                                          \
+                    for (int x = 0; x < W_OUT; x++) {                                                   \
+                        _Pragma("HLS PIPELINE II=1")                                                    \
+                        for (int oc = 0; oc < TOC; oc++) {                                              \
+                            acc[oc][r][x] = oc0 + oc < (out_ch) ? net->name.biases[oc0 + oc] : 0.0f;    \
+                        }                                                                               \
+                    }                                                                                   \
+                }                                                                                       \
+                ic_tiles: for (int ic0 = 0; ic0 < (in_ch); ic0 += TIC) {                                \
+                    /* Input rows of the tile, zero outside the map (padding) and past the last channel */ \
+                    load_input: for (int y = 0; y < IN_ROWS; y++) {                                     \
+                        for (int x = 0; x < IN_COLS; x++) {                                             \
+                            for (int ic = 0; ic < TIC; ic++) {                                          \
+                                _Pragma("HLS PIPELINE II=1")                                            \
+                                int h = r0 * (stride) + y - (padding);                                  \
+                                int w = x - (padding);                                                  \
+                                int c = ic0 + ic;                                                       \
+                                int inside = h >= 0 && h < H_IN && w >= 0 && w < W_IN && c < (in_ch);   \
+                                in_tile[ic][y][x] = inside ? in[(h * W_IN + w) * (in_ch) + c] : 0.0f;   \
+                            }                                                                           \
+                        }                                                                               \
+                    }                                                                                   \
+                    load_weights: for (int oc = 0; oc < TOC; oc++) {                                    \
+                        for (int ic = 0; ic < TIC; ic++) {                                              \
+                            for (int kh = 0; kh < (kernel); kh++) {                                     \
+                                for (int kw = 0; kw < (kernel); kw++) {                                 \
+                                    _Pragma("HLS PIPELINE II=1")                                        \
+                                    int valid = oc0 + oc < (out_ch) && ic0 + ic < (in_ch);              \
+                                    w_tile[oc][ic][kh][kw] =                                            \
+                                        valid ? net->name.weights[oc0 + oc][ic0 + ic][kh][kw] : 0.0f;   \
+                                }                                                                       \
+                            }                                                                           \
+                        }                                                                               \
+                    }                                                                                   \
+                    /* TOC x TIC x kernel x kernel MACs per cycle */                                    \
+                    compute: for (int r = 0; r < TR; r++) {                                             \
+                        for (int x = 0; x < W_OUT; x++) {                                               \
+                            _Pragma("HLS PIPELINE II=1")                                                \
+                            for (int oc = 0; oc < TOC; oc++) {                                          \
+                                for (int ic = 0; ic < TIC; ic++) {                                      \
+                                    for (int kh = 0; kh < (kernel); kh++) {                             \
+                                        for (int kw = 0; kw < (kernel); kw++) {                         \
+                                            acc[oc][r][x] += in_tile[ic][r * (stride) + kh][x * (stride) + kw] * \
+                                                             w_tile[oc][ic][kh][kw];                    \
+                                        }                                                               \
+                                    }                                                                   \
+                                }                                                                       \
+                            }                                                                           \
+                        }                                                                               \
+                    }                                                                                   \
+                }                                                                                       \
+                store: for (int r = 0; r < TR; r++) {                                                   \
+                    for (int x = 0; x < W_OUT; x++) {                                                   \
+                        for (int oc = 0; oc < TOC; oc++) {                                              \
+                            _Pragma("HLS PIPELINE II=1")                                                \
+                            if (r0 + r < H_OUT && oc0 + oc < (out_ch)) {                                \
+                                float value = acc[oc][r][x];                                            \
+                                out[((r0 + r) * W_OUT + x) * (out_ch) + oc0 + oc] =                     \
+                                    (activation) == CNN_ACT_RELU ? relu(value) : value;                 \
+                            }                                                                           \
+                        }                                                                               \
+                    }                                                                                   \
+                }                                                                                       \
+            }                                                                                           \
+        }                                                                                               \
+    }
+
+// Generates <layer>_layer() for a max pooling
+// For each output row, the size input rows it covers are read in one burst into a line buffer,
+// then the outputs are computed from the buffer at one value per cycle: the size x size window of
+// an output spans size consecutive columns, which land in distinct banks of the cyclic partition.
+#define CNN_POOL_KERNEL(name, source, size, stride)                                                 \
+    static void name##_layer(const float *in, float *out, const CNN *net) {                        \
+        _Pragma("HLS INLINE off")                                                                   \
+        enum { W_IN = CNN_##source##_W, C = CNN_##name##_C, H_OUT = CNN_##name##_H, W_OUT = CNN_##name##_W }; \
+        float rows[size][W_IN][C];                                                                  \
+        _Pragma("HLS ARRAY_PARTITION variable=rows complete dim=1")                                 \
+        _Pragma("HLS ARRAY_PARTITION variable=rows cyclic factor=size dim=2")                       \
+        (void)net;                                                                                  \
+        max_pooling: for (int h = 0; h < H_OUT; h++) {                                              \
+            load_rows: for (int ph = 0; ph < (size); ph++) {                                        \
+                for (int w = 0; w < W_IN; w++) {                                                    \
+                    for (int c = 0; c < C; c++) {                                                   \
+                        _Pragma("HLS PIPELINE II=1")                                                \
+                        rows[ph][w][c] = in[((h * (stride) + ph) * W_IN + w) * C + c];              \
+                    }                                                                               \
+                }                                                                                   \
+            }                                                                                       \
+            pool_row: for (int w = 0; w < W_OUT; w++) {                                             \
+                for (int c = 0; c < C; c++) {                                                       \
+                    _Pragma("HLS PIPELINE II=1")                                                    \
+                    float max = rows[0][w * (stride)][c];                                           \
+                    for (int k = 1; k < (size) * (size); k++) {                                     \
+                        float value = rows[k / (size)][w * (stride) + k % (size)][c];               \
+                        if (value > max) {                                                          \
+                            max = value;                                                            \
+                        }                                                                           \
+                    }                                                                               \
+                    out[(h * W_OUT + w) * C + c] = max;                                             \
+                }                                                                                   \
+            }                                                                                       \
+        }                                                                                           \
+    }
+
+// Generates <layer>_layer() for a fully connected layer
+// The outputs are computed one tile of CNN_TILE_OC at a time. The weight rows of the tile are first
+// read in one burst each, in the flattened (c, h, w) order of PyTorch, and stored on chip in the
+// (h, w, c) order of the map; the inputs are then read once per tile, in map order, for TO MACs
+// per cycle from the on-chip rows. Each output has CNN_FC_ACCUMULATORS interleaved partial sums
+// combined by a tree at the end, like the FC stage of ConvNet.c.
+#define CNN_FC_KERNEL(name, source, n_out, activation)                                              \
+    static void name##_layer(const float *in, float *out, const CNN *net) {                        \
+        _Pragma("HLS INLINE off")                                                                   \
+        enum {                                                                                      \
+            H_IN = CNN_##source##_H, W_IN = CNN_##source##_W, C_IN = CNN_##source##_C,              \
+            TO = CNN_MIN(CNN_TILE_OC, n_out)                                                        \
+        };                                                                                          \
+        float w_tile[TO][H_IN * W_IN * C_IN];                                                       \
+        float partial[TO][CNN_FC_ACCUMULATORS];                                                     \
+        _Pragma("HLS ARRAY_PARTITION variable=w_tile complete dim=1")                               \
+        _Pragma("HLS ARRAY_PARTITION variable=partial complete dim=0")                              \
+                                                                                                    \
+        output_tiles: for (int o0 = 0; o0 < (n_out); o0 += TO) {                                    \
+            load_weights: for (int o = 0; o < TO; o++) {                                            \
+                int i = 0;                                                                          \
+                for (int c = 0; c < C_IN; c++) {                                                    \
+                    for (int h = 0; h < H_IN; h++) {                                                \
+                        for (int w = 0; w < W_IN; w++) {                                            \
+                            _Pragma("HLS PIPELINE II=1")                                            \
+                            w_tile[o][(h * W_IN + w) * C_IN + c] =                                  \
+                                o0 + o < (n_out) ? net->name.weights[o0 + o][i] : 0.0f;             \
+                            i++;                                                                    \
+                        }                                                                           \
+                    }                                                                               \
+                }                                                                                   \
+            }                                                                                       \
+            /* Initialize with the biases */                                                        \
+            for (int o = 0; o < TO; o++) {                                                          \
+                _Pragma("HLS UNROLL")                                                               \
+                partial[o][0] = o0 + o < (n_out) ? net->name.biases[o0 + o] : 0.0f;                 \
+                for (int a = 1; a < CNN_FC_ACCUMULATORS; a++) {                                     \
+                    partial[o][a] = 0.0f;                                                           \
+                }                                                                                   \
+            }                                                                                       \
+            fully_connected_loop: for (int i = 0; i < H_IN * W_IN * C_IN; i++) {                    \
+                _Pragma("HLS PIPELINE II=1")                                                        \
+                _Pragma("HLS DEPENDENCE variable=partial inter distance=CNN_FC_ACCUMULATORS true")  \
+                float value = in[i];                                                                \
+                for (int o = 0; o < TO; o++) {                                                      \
+                    partial[o][i % CNN_FC_ACCUMULATORS] += value * w_tile[o][i];                    \
+                }                                                                                   \
+            }                                                                                       \
+            /* Partial-sum tree */                                                                  \
+            for (int stride = CNN_FC_ACCUMULATORS / 2; stride > 0; stride /= 2) {                   \
+                _Pragma("HLS UNROLL")                                                               \
+                for (int o = 0; o < TO; o++) {                                                      \
+                    for (int a = 0; a < stride; a++) {                                              \
+                        partial[o][a] += partial[o][a + stride];                                    \
+                    }                                                                               \
+                }                                                                                   \
+            }                                                                                       \
+            for (int o = 0; o < TO && o0 + o < (n_out); o++) {                                      \
+                out[o0 + o] = (activation) == CNN_ACT_RELU ? relu(partial[o][0]) : partial[o][0];   \
+            }                                                                                       \
+        }                                                                                           \
+    }
+
+CNN_LAYERS(CNN_CONV_KERNEL, CNN_POOL_KERNEL, CNN_FC_KERNEL)
+
+// Runs a layer on the map of its source; every layer writes its map to its own workspace region
+#define CNN_LAYER_CALL(name, source, ...)                       \
+    float *map_##name = workspace + CNN_##name##_OFFSET;        \
+    name##_layer(map_##source, map_##name, net);
+
+#define CNN_LAYER_MAP(name) CNN_LAYER_MAP_(name)
+#define CNN_LAYER_MAP_(name) map_##name
+
+int cnn_forward(const CNN *net, const float *input, float *workspace, float output[CNN_OUTPUTS]) {
+    #pragma HLS INTERFACE m_axi port=net offset=slave bundle=gmem0 depth=1
+    #pragma HLS INTERFACE m_axi port=input offset=slave bundle=gmem1 depth=CNN_input_SIZE
+    #pragma HLS INTERFACE m_axi port=workspace offset=slave bundle=gmem2 depth=CNN_WORKSPACE_SIZE
+    #pragma HLS INTERFACE s_axilite port=output
+    #pragma HLS INTERFACE s_axilite port=return
+
+    const float *map_input = input;
+    CNN_LAYERS(CNN_LAYER_CALL, CNN_LAYER_CALL, CNN_LAYER_CALL)
+
+    const float *last = CNN_LAYER_MAP(CNN_OUTPUT_LAYER);
+    int max_index = 0;
+    for (int i = 0; i < CNN_OUTPUTS; i++) {
+        output[i] = last[i];
+        if (last[i] > last[max_index]) {
+            max_index = i;
+        }
+    }
+    return max_index;
+}
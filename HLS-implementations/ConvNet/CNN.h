@@ -0,0 +1,110 @@
+#ifndef CNN_H
+#define CNN_H
+
+// Layered CNN engine: stacked convolution, max-pooling and fully connected layers described by a
+// model descriptor (see CNN_model.h). CNN.c generates the weight structure and one kernel per layer
+// from it. Build with -DCNN_MODEL='"my_model.h"' to use another descriptor.
+//
+// The feature maps stay in external memory (the workspace) and the layers work on tiles of them:
+// a convolution loads CNN_TILE_ROWS output rows x CNN_TILE_OC output channels x CNN_TILE_IC input
+// channels at a time, so neither the maps nor the weights of a layer need a full on-chip copy.
+// The fixed single-layer pipeline of ConvNet.c stays the fastest option for the MNIST network.
+
+// Layer activations
+#define CNN_ACT_NONE 0             // Identity
+#define CNN_ACT_RELU 1             // max(x, 0)
+
+#ifdef CNN_MODEL
+#include CNN_MODEL
+#else
+#include "CNN_model.h"
+#endif
+
+// Tile sizes of the convolutions, clipped to the size of each layer
+#ifndef CNN_TILE_ROWS
+#define CNN_TILE_ROWS 8            // Output rows per tile
+#endif
+#ifndef CNN_TILE_OC
+#define CNN_TILE_OC 8              // Output channels per tile
+#endif
+#ifndef CNN_TILE_IC
+#define CNN_TILE_IC 8              // Input channels per tile
+#endif
+#ifndef CNN_FC_ACCUMULATORS
+#define CNN_FC_ACCUMULATORS 4      // Interleaved partial sums per output of the FC layers (power of two)
+#endif
+
+/*------------------------ Layer shapes ------------------------*/
+
+// Every map is stored in (h, w, c) order. For each layer the descriptor gives
+// CNN_<name>_H, _W, _C (output shape), _SIZE (floats) and _OFFSET (position in the workspace).
+enum {
+    CNN_input_H = CNN_INPUT_HEIGHT,
+    CNN_input_W = CNN_INPUT_WIDTH,
+    CNN_input_C = CNN_INPUT_CHANNELS,
+    CNN_input_SIZE = CNN_INPUT_HEIGHT * CNN_INPUT_WIDTH * CNN_INPUT_CHANNELS,
+    CNN_input_END = 0              // The input is not in the workspace
+};
+
+#define CNN_SHAPE(name, height, width, channels, source)        \
+    enum {                                                      \
+        CNN_##name##_H = (height),                              \
+        CNN_##name##_W = (width),                               \
+        CNN_##name##_C = (channels),                            \
+        CNN_##name##_SIZE = (height) * (width) * (channels),    \
+        CNN_##name##_OFFSET = CNN_##source##_END,               \
+        CNN_##name##_END = CNN_##source##_END + (height) * (width) * (channels) \
+    };
+
+#define CNN_CONV_SHAPE(name, source, in_ch, out_ch, kernel, stride, padding, activation) \
+    CNN_SHAPE(name, (CNN_##source##_H + 2 * (padding) - (kernel)) / (stride) + 1,         \
+              (CNN_##source##_W + 2 * (padding) - (kernel)) / (stride) + 1, out_ch, source)
+#define CNN_POOL_SHAPE(name, source, size, stride)                 \
+    CNN_SHAPE(name, (CNN_##source##_H - (size)) / (stride) + 1,    \
+              (CNN_##source##_W - (size)) / (stride) + 1, CNN_##source##_C, source)
+#define CNN_FC_SHAPE(name, source, n_out, activation) CNN_SHAPE(name, 1, 1, n_out, source)
+
+CNN_LAYERS(CNN_CONV_SHAPE, CNN_POOL_SHAPE, CNN_FC_SHAPE)
+
+#define CNN_LAYER_VALUE(name, field) CNN_LAYER_VALUE_(name, field)
+#define CNN_LAYER_VALUE_(name, field) CNN_##name##_##field
+
+#define CNN_OUTPUTS CNN_LAYER_VALUE(CNN_OUTPUT_LAYER, SIZE)          // Output width (number of classes)
+#define CNN_WORKSPACE_SIZE CNN_LAYER_VALUE(CNN_OUTPUT_LAYER, END)    // Floats of all the feature maps
+
+/*------------------------ Data Structures ------------------------*/
+
+// Weights of a layer, sized exactly for its shape (pooling layers have none)
+#define CNN_CONV_STRUCT(name, source, in_ch, out_ch, kernel, stride, padding, activation)  \
+    struct {                                                                            \
+        float weights[out_ch][in_ch][kernel][kernel];  /* filters, PyTorch layout */    \
+        float biases[out_ch];                          /* biases of the filters */      \
+    } name;
+#define CNN_POOL_STRUCT(name, source, size, stride)
+#define CNN_FC_STRUCT(name, source, n_out, activation)                                  \
+    struct {                                                                            \
+        float weights[n_out][CNN_##source##_SIZE];     /* weights, (c, h, w) inputs */  \
+        float biases[n_out];                           /* biases of the layer */        \
+    } name;
+
+// Weights of the network, one field per conv and FC layer of the descriptor
+typedef struct {
+    CNN_LAYERS(CNN_CONV_STRUCT, CNN_POOL_STRUCT, CNN_FC_STRUCT)
+} CNN;
+
+// Number of floats in the weights of the network (the fields of CNN, back to back)
+#define CNN_CONV_WEIGHT_COUNT(name, source, in_ch, out_ch, kernel, stride, padding, activation) \
+    + (out_ch) * ((in_ch) * (kernel) * (kernel) + 1)
+#define CNN_POOL_WEIGHT_COUNT(name, source, size, stride)
+#define CNN_FC_WEIGHT_COUNT(name, source, n_out, activation) + (n_out) * (CNN_##source##_SIZE + 1)
+#define CNN_WEIGHT_COUNT (0 CNN_LAYERS(CNN_CONV_WEIGHT_COUNT, CNN_POOL_WEIGHT_COUNT, CNN_FC_WEIGHT_COUNT))
+
+/*-------------------------- Functions ---------------------------*/
+
+// Forward pass of one image through all the layers
+// net holds the weights (the payload of a weights file has the same layout), input one image in
+// (h, w, c) order, workspace CNN_WORKSPACE_SIZE floats for the feature maps. output receives the
+// output layer. Returns the predicted class.
+int cnn_forward(const CNN *net, const float *input, float *workspace, float output[CNN_OUTPUTS]);
+
+#endif // CNN_H
@@ -0,0 +1,31 @@
+#ifndef CNN_MODEL_H
+#define CNN_MODEL_H
+
+// Model descriptor of the MNIST classifier, the default model of the layered CNN engine (see CNN.h).
+// It describes the same network as ConvNet.h, so the engine reproduces forward() exactly.
+//
+// A descriptor defines:
+//   CNN_INPUT_HEIGHT, CNN_INPUT_WIDTH, CNN_INPUT_CHANNELS
+//                          shape of the input image, stored in (h, w, c) order
+//   CNN_LAYERS(CONV, POOL, FC)
+//                          the layers in order, each reading the output of the layer before it
+//                          (input for the first one):
+//                          CONV(name, source, in_channels, out_channels, kernel, stride, padding, activation)
+//                          POOL(name, source, size, stride)            max pooling
+//                          FC(name, source, n_out, activation)         flattens its input in the
+//                                                                      (c, h, w) order of PyTorch
+//                          activation is CNN_ACT_RELU or CNN_ACT_NONE
+//   CNN_OUTPUT_LAYER       name of the last layer
+
+#define CNN_INPUT_HEIGHT 28
+#define CNN_INPUT_WIDTH 28
+#define CNN_INPUT_CHANNELS 1
+
+#define CNN_LAYERS(CONV, POOL, FC)                                  \
+    CONV(conv1, input, 1, 3, 3, 1, 1, CNN_ACT_RELU)                 \
+    POOL(pool1, conv1, 2, 2)                                        \
+    FC(fc1, pool1, 10, CNN_ACT_NONE)
+
+#define CNN_OUTPUT_LAYER fc1
+
+#endif // CNN_MODEL_H
@@ -2,6 +2,7 @@
 #include <string.h>
 #include <math.h>
 #include "ConvNet.h"
+#include "ConvNet_sparse_weights.h"
 
 // ReLU activation function
 float reLu(float x) {
@@ -10,6 +11,9 @@ float reLu(float x) {
 }
 
 // Initialize the Convconvnet structure with predefined weights and biases
+// Build with -DCONVNET_EXTERNAL_WEIGHTS to leave out the tables below and load them at run time
+// (convnet_map_weights() on the host, forward_weights() on the FPGA).
+#ifndef CONVNET_EXTERNAL_WEIGHTS
 ConvNet convnet = {
     .conv1 = {
         // Convolutional layer weights
@@ -39,132 +43,1082 @@ ConvNet convnet = {
         .biases = {0.05260896,0.1124865,-0.066540465,-0.069363676,-0.04490001,-0.058510244,0.09162572,0.03159556,-0.03333238,0.0014228189},
     }
 };
+#else
+ConvNet convnet;
+#endif
+
+#ifdef __SYNTHESIS__
+#define CONVNET_PARAMS convnet
+#else
+// On the host the stages read the weights through convnet_params, so they can also run directly
+// on a memory-mapped weights file
+const ConvNet *convnet_params = &convnet;
+#define CONVNET_PARAMS (*convnet_params)
+#endif
+
+// Opt-in layer profiling (-DCONVNET_PROFILE), compiled out otherwise
+// Each stage has its own counters, so every dataflow process only updates its own variable.
+// The counts are added once per call of a stage.
+#ifdef CONVNET_PROFILE
+static LayerCounters profile_conv;
+static LayerCounters profile_wconv;
+static LayerCounters profile_pool;
+static LayerCounters profile_fc;
+static LayerCounters profile_sfc;
+#ifdef __SYNTHESIS__
+// On the FPGA the stages read the free-running cycle counter wired to the cycle_counter port of
+// forward_profiled(), passed down the stages as an extra argument. The other top functions have
+// no such port and pass profile_no_clock, which never moves, so only forward_profiled() measures.
+static const volatile uint64_t profile_no_clock = 0;
+#define PROFILE_CLOCK_PARAM , const volatile uint64_t *cycle_counter
+#define PROFILE_CLOCK_ARG , cycle_counter
+#define PROFILE_NO_CLOCK_ARG , &profile_no_clock
+#define PROFILE_CLOCK() (*cycle_counter)
+#define PROFILE_ADD(stage, field, n) (profile_##stage.field += (n))
+// Stall cycles of a pipelined loop: the counter is latched at the first and the last iteration.
+// Without stalls consecutive iterations start ii cycles apart, so any extra cycle between them is
+// one the pipeline spent waiting on an empty input or a full output FIFO. A counter that never
+// moves (profile_no_clock) gives a shorter span, and no stall is counted.
+#define PROFILE_LOOP_BEGIN(stage) uint64_t profile_first_##stage = 0, profile_last_##stage = 0, profile_iters_##stage = 0
+#define PROFILE_ITERATION(stage)                                                                     \
+    do {                                                                                             \
+        uint64_t profile_now = PROFILE_CLOCK();                                                      \
+        if (profile_iters_##stage++ == 0) {                                                          \
+            profile_first_##stage = profile_now;                                                     \
+        }                                                                                            \
+        profile_last_##stage = profile_now;                                                          \
+    } while (0)
+#define PROFILE_LOOP_END(stage, ii)                                                                  \
+    do {                                                                                             \
+        uint64_t profile_span = profile_last_##stage - profile_first_##stage;                        \
+        uint64_t profile_busy = profile_iters_##stage ? (profile_iters_##stage - 1) * (ii) : 0;      \
+        uint64_t profile_stall = profile_span > profile_busy ? profile_span - profile_busy : 0;      \
+        PROFILE_ADD(stage, stall_cycles, profile_stall);                                             \
+    } while (0)
+#else
+#include "../host/profile_clock.h"
+// On the host the stages can run on several worker threads at once, and do not stall
+#define PROFILE_CLOCK_PARAM
+#define PROFILE_CLOCK_ARG
+#define PROFILE_NO_CLOCK_ARG
+#define PROFILE_CLOCK() profile_clock()
+#define PROFILE_ADD(stage, field, n) __atomic_fetch_add(&profile_##stage.field, (n), __ATOMIC_RELAXED)
+#define PROFILE_LOOP_BEGIN(stage)
+#define PROFILE_ITERATION(stage)
+#define PROFILE_LOOP_END(stage, ii)
+#endif
+#define PROFILE_START(stage) uint64_t profile_start_##stage = PROFILE_CLOCK()
+#define PROFILE_STOP(stage) PROFILE_ADD(stage, time, PROFILE_CLOCK() - profile_start_##stage)
+#else
+#define PROFILE_CLOCK_PARAM
+#define PROFILE_CLOCK_ARG
+#define PROFILE_NO_CLOCK_ARG
+#define PROFILE_ADD(stage, field, n)
+#define PROFILE_START(stage)
+#define PROFILE_STOP(stage)
+#define PROFILE_LOOP_BEGIN(stage)
+#define PROFILE_ITERATION(stage)
+#define PROFILE_LOOP_END(stage, ii)
+#endif
+
+// Number of values flowing from the convolution to the pooling stage
+#define CONV_STREAM_SIZE (INPUT_HEIGHT * INPUT_WIDTH * CONV1_OUTPUT_CHANNELS)
+
+// Line buffer of the streaming convolution
+// Holds the two most recent input rows and the 3x3 sliding window, so every input pixel
+// is read exactly once and all output channels are computed from the same window.
+typedef struct {
+    float rows[2][INPUT_WIDTH][INPUT_CHANNELS];  // rows[0] = row r-2, rows[1] = row r-1
+    float window[3][3][INPUT_CHANNELS];          // window[kh][kw], column 2 is the newest
+} ConvLineBuffer;
+
+// Reset the line buffer before a new image (the rows above the image are zero padding)
+static void conv_reset(ConvLineBuffer *lb) {
+    for (int i = 0; i < 2; i++) {
+        for (int w = 0; w < INPUT_WIDTH; w++) {
+            for (int c = 0; c < INPUT_CHANNELS; c++) {
+                lb->rows[i][w][c] = 0.0f;
+            }
+        }
+    }
+}
+
+// Push input row r through the line buffer and compute output row r-1 of the convolution
+// Call it for r = 0 .. INPUT_HEIGHT; row is only read while r < INPUT_HEIGHT, the last call
+// pushes the bottom zero-padding row. Outputs are written to conv_stream in (h, w, oc) order.
+static void conv_push_row(ConvLineBuffer *lb, float row[INPUT_WIDTH][INPUT_CHANNELS], int r,
+                          float conv_stream[CONV_STREAM_SIZE] PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE
+    PROFILE_START(conv);
+
+    // Left zero-padding column
+    for (int kh = 0; kh < 3; kh++) {
+        for (int kw = 0; kw < 3; kw++) {
+            for (int c = 0; c < INPUT_CHANNELS; c++) {
+                lb->window[kh][kw][c] = 0.0f;
+            }
+        }
+    }
+
+    // One extra column for the right zero-padding
+    PROFILE_LOOP_BEGIN(conv);
+    conv_row: for (int w = 0; w <= INPUT_WIDTH; w++) {
+        #pragma HLS PIPELINE II=1
+        PROFILE_ITERATION(conv);
+        for (int c = 0; c < INPUT_CHANNELS; c++) {
+            // Shift the window left
+            for (int kh = 0; kh < 3; kh++) {
+                lb->window[kh][0][c] = lb->window[kh][1][c];
+                lb->window[kh][1][c] = lb->window[kh][2][c];
+            }
+
+            if (w < INPUT_WIDTH) {
+                // Read the new pixel (zero for the bottom padding row) and rotate the line buffer
+                float pixel = r < INPUT_HEIGHT ? row[w][c] : 0.0f;
+                lb->window[0][2][c] = lb->rows[0][w][c];
+                lb->window[1][2][c] = lb->rows[1][w][c];
+                lb->window[2][2][c] = pixel;
+                lb->rows[0][w][c] = lb->rows[1][w][c];
+                lb->rows[1][w][c] = pixel;
+            } else {
+                lb->window[0][2][c] = 0.0f;
+                lb->window[1][2][c] = 0.0f;
+                lb->window[2][2][c] = 0.0f;
+            }
+        }
+
+        // The window is centered on pixel (r-1, w-1): compute all output channels for it
+        if (r > 0 && w > 0) {
+            for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                // Initialize with bias value
+                float sum = CONVNET_PARAMS.conv1.biases[oc];
+                for (int ic = 0; ic < INPUT_CHANNELS; ic++) {
+                    for (int kh = 0; kh < 3; kh++) {
+                        for (int kw = 0; kw < 3; kw++) {
+                            sum += lb->window[kh][kw][ic] * CONVNET_PARAMS.conv1.weights[oc][ic][kh][kw];
+                        }
+                    }
+                }
+                // Apply ReLU activation function
+                conv_stream[((r - 1) * INPUT_WIDTH + (w - 1)) * CONV1_OUTPUT_CHANNELS + oc] = reLu(sum);
+            }
+        }
+    }
+
+    // One call per input row plus the bottom padding; row 0 only fills the line buffer
+    PROFILE_STOP(conv);
+    PROFILE_LOOP_END(conv, 1);
+    PROFILE_ADD(conv, macs, r > 0 ? INPUT_WIDTH * CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 9 : 0);
+    PROFILE_ADD(conv, calls, r == INPUT_HEIGHT);
+}
+
+// Convolution stage: conv + ReLU, reads the input once in raster order
+static void conv_stage(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],
+                       float conv_stream[CONV_STREAM_SIZE] PROFILE_CLOCK_PARAM) {
+    ConvLineBuffer line_buffer;
+    #pragma HLS ARRAY_PARTITION variable=line_buffer.rows complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=line_buffer.window complete dim=0
+    conv_reset(&line_buffer);
+    convolutional_layer: for (int r = 0; r <= INPUT_HEIGHT; r++) {
+        conv_push_row(&line_buffer, input[r < INPUT_HEIGHT ? r : INPUT_HEIGHT - 1], r, conv_stream PROFILE_CLOCK_ARG);
+    }
+}
+
+// MaxPooling stage: consumes the conv rows as they are produced
+// Keeps one row of running maxima and emits a pooled row after every POOL_SIZE conv rows,
+// in (h, w, oc) order.
+static void pool_stage(float conv_stream[CONV_STREAM_SIZE], float pool_stream[FC1_INPUT_SIZE] PROFILE_CLOCK_PARAM) {
+    // Running maxima of the pooling windows of the current pooled row
+    float row_max[POOL_WIDTH][CONV1_OUTPUT_CHANNELS];
+    PROFILE_START(pool);
+
+    int in_idx = 0;
+    int out_idx = 0;
+    PROFILE_LOOP_BEGIN(pool);
+    max_pooling: for (int h = 0; h < INPUT_HEIGHT; h++) {
+        for (int w = 0; w < INPUT_WIDTH; w++) {
+            for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                #pragma HLS PIPELINE II=1
+                PROFILE_ITERATION(pool);
+                float val = conv_stream[in_idx++];
+                int pw = w / POOL_SIZE;
+                // The first value of a window initializes it, the others update the maximum
+                if ((h % POOL_SIZE == 0 && w % POOL_SIZE == 0) || val > row_max[pw][oc]) {
+                    row_max[pw][oc] = val;
+                }
+                // Emit the window once its last value has been seen
+                if (h % POOL_SIZE == POOL_SIZE - 1 && w % POOL_SIZE == POOL_SIZE - 1) {
+                    pool_stream[out_idx++] = row_max[pw][oc];
+                }
+            }
+        }
+    }
+
+    PROFILE_STOP(pool);
+    PROFILE_LOOP_END(pool, 1);
+    PROFILE_ADD(pool, calls, 1);
+}
+
+#if FC_ACCUMULATORS < 1 || (FC_ACCUMULATORS & (FC_ACCUMULATORS - 1)) != 0
+#error "FC_ACCUMULATORS must be a power of two"
+#endif
+
+// II of the FC loop with a 4-cycle fadd
+#define FC_II ((4 + FC_ACCUMULATORS - 1) / FC_ACCUMULATORS)
+
+#if CONVNET_TOP_K < 1 || CONVNET_TOP_K > NUM_CLASSES
+#error "CONVNET_TOP_K must be 1 to NUM_CLASSES"
+#endif
+
+// Fully connected layer: accumulates every pooled value into all the class scores on the fly
+// Pooled values arrive in (h, w, oc) order, the weights are indexed in the (oc, h, w) order of
+// the flattened PyTorch tensor. The weight ROM is reshaped so one read returns the weights of
+// all the classes for an input.
+// Each class has FC_ACCUMULATORS interleaved partial sums: consecutive inputs go to different
+// accumulators, so the float adder latency no longer limits the II (II = ceil(4 / FC_ACCUMULATORS)
+// with a 4-cycle fadd). fc_reduce() then combines them into the class scores.
+static void fc_accumulate(float pool_stream[FC1_INPUT_SIZE], float partial[NUM_CLASSES][FC_ACCUMULATORS]
+                          PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE
+    #pragma HLS ARRAY_RESHAPE variable=convnet.fc1.weights complete dim=1
+    PROFILE_START(fc);
+
+    // Initialize with bias values
+    for (int o = 0; o < NUM_CLASSES; o++) {
+        #pragma HLS UNROLL
+        partial[o][0] = CONVNET_PARAMS.fc1.biases[o];
+        for (int a = 1; a < FC_ACCUMULATORS; a++) {
+            partial[o][a] = 0.0f;
+        }
+    }
+
+    int in_idx = 0;
+    PROFILE_LOOP_BEGIN(fc);
+    fully_connected_loop: for (int h = 0; h < POOL_HEIGHT; h++) {
+        for (int w = 0; w < POOL_WIDTH; w++) {
+            for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                #pragma HLS PIPELINE II=1
+                #pragma HLS DEPENDENCE variable=partial inter distance=FC_ACCUMULATORS true
+                PROFILE_ITERATION(fc);
+                int lane = in_idx % FC_ACCUMULATORS;
+                float val = pool_stream[in_idx++];
+                int i = (oc * POOL_HEIGHT + h) * POOL_WIDTH + w;
+                // Weighted sum of inputs, all classes in parallel
+                for (int o = 0; o < NUM_CLASSES; o++) {
+                    partial[o][lane] += val * CONVNET_PARAMS.fc1.weights[o][i];
+                }
+            }
+        }
+    }
+
+    PROFILE_STOP(fc);
+    PROFILE_LOOP_END(fc, FC_II);
+    PROFILE_ADD(fc, macs, FC1_INPUT_SIZE * NUM_CLASSES);
+    PROFILE_ADD(fc, calls, 1);
+}
+
+// Partial-sum tree of one class: adds up its FC_ACCUMULATORS interleaved sums into the class score
+static float fc_reduce(float partial[FC_ACCUMULATORS]) {
+    #pragma HLS INLINE
+    partial_sums: for (int stride = FC_ACCUMULATORS / 2; stride > 0; stride /= 2) {
+        #pragma HLS UNROLL
+        for (int a = 0; a < stride; a++) {
+            partial[a] += partial[a + stride];
+        }
+    }
+    return partial[0];
+}
+
+// Fully connected stage: outputs all the class scores
+static void fc_stage(float pool_stream[FC1_INPUT_SIZE], float output[NUM_CLASSES] PROFILE_CLOCK_PARAM) {
+    float partial[NUM_CLASSES][FC_ACCUMULATORS];
+    #pragma HLS ARRAY_PARTITION variable=partial complete dim=0
+    fc_accumulate(pool_stream, partial PROFILE_CLOCK_ARG);
+
+    // Reduce and store the class scores
+    for (int o = 0; o < NUM_CLASSES; o++) {
+        output[o] = fc_reduce(partial[o]);
+    }
+}
+
+// Inserts a class score into top, kept sorted by decreasing score
+// The comparisons with all the entries are unrolled into a chain of compare-and-shift cells, so a
+// new score is inserted every cycle. On equal scores the lower class stays first, like the argmax.
+static void topk_insert(ClassScore top[CONVNET_TOP_K], int label, float score) {
+    #pragma HLS INLINE
+    for (int i = CONVNET_TOP_K - 1; i >= 0; i--) {
+        #pragma HLS UNROLL
+        if (score > top[i].score) {
+            if (i + 1 < CONVNET_TOP_K) {
+                top[i + 1] = top[i];
+            }
+            top[i].label = label;
+            top[i].score = score;
+        }
+    }
+}
+
+// FC stage with the top-k selection fused in: the output loop reduces one class per cycle and
+// inserts its score into the top-k in the same pipeline iteration, so the scores are never stored
+// and the selection adds no pass of its own after the reduction.
+// Entries scoring below threshold are marked with label -1.
+static void fc_topk_stage(float pool_stream[FC1_INPUT_SIZE], float threshold, ClassScore top[CONVNET_TOP_K]
+                          PROFILE_CLOCK_PARAM) {
+    float partial[NUM_CLASSES][FC_ACCUMULATORS];
+    ClassScore best[CONVNET_TOP_K];
+    #pragma HLS ARRAY_PARTITION variable=partial complete dim=0
+    #pragma HLS ARRAY_PARTITION variable=best complete
+    fc_accumulate(pool_stream, partial PROFILE_CLOCK_ARG);
+
+    for (int i = 0; i < CONVNET_TOP_K; i++) {
+        #pragma HLS UNROLL
+        best[i].label = -1;
+        best[i].score = -INFINITY;
+    }
+    topk_loop: for (int o = 0; o < NUM_CLASSES; o++) {
+        #pragma HLS PIPELINE II=1
+        topk_insert(best, o, fc_reduce(partial[o]));
+    }
+    for (int i = 0; i < CONVNET_TOP_K; i++) {
+        top[i].label = best[i].score >= threshold ? best[i].label : -1;
+        top[i].score = best[i].score;
+    }
+}
+
+// Conv, pool and FC stages connected by FIFOs, inlined into the DATAFLOW region of the caller
+static void pipeline_stages(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]
+                            PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE
+
+    // FIFOs between the stages
+    float conv_stream[CONV_STREAM_SIZE];
+    float pool_stream[FC1_INPUT_SIZE];
+    #pragma HLS STREAM variable=conv_stream depth=INPUT_WIDTH*CONV1_OUTPUT_CHANNELS
+    #pragma HLS STREAM variable=pool_stream depth=POOL_WIDTH*CONV1_OUTPUT_CHANNELS
+
+    conv_stage(input, conv_stream PROFILE_CLOCK_ARG);
+    pool_stage(conv_stream, pool_stream PROFILE_CLOCK_ARG);
+    fc_stage(pool_stream, output PROFILE_CLOCK_ARG);
+}
+
+// The stages as a dataflow region of their own, for the callers that are not dataflow regions
+static void run_pipeline(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]
+                         PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    pipeline_stages(input, output PROFILE_CLOCK_ARG);
+}
+
+// Conv, pool and the top-k FC stage as a dataflow pipeline
+static void run_topk_pipeline(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float threshold,
+                              ClassScore top[CONVNET_TOP_K] PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    float conv_stream[CONV_STREAM_SIZE];
+    float pool_stream[FC1_INPUT_SIZE];
+    #pragma HLS STREAM variable=conv_stream depth=INPUT_WIDTH*CONV1_OUTPUT_CHANNELS
+    #pragma HLS STREAM variable=pool_stream depth=POOL_WIDTH*CONV1_OUTPUT_CHANNELS
+
+    conv_stage(input, conv_stream PROFILE_CLOCK_ARG);
+    pool_stage(conv_stream, pool_stream PROFILE_CLOCK_ARG);
+    fc_topk_stage(pool_stream, threshold, top PROFILE_CLOCK_ARG);
+}
 
 // Forward pass function
 // This function performs the forward propagation for a simple convolutional neural network (ConvNet).
 // It processes the input through a convolutional layer, max-pooling layer, and fully connected layer to produce class scores.
+// The three stages run as a dataflow pipeline connected by FIFOs, so pooling starts on the first conv
+// rows and the FC layer accumulates pooled values as they arrive; no full feature map is stored.
+// The input is read once, in raster order, so it is mapped to an AXI stream.
+// The top function is the DATAFLOW region itself: with ap_ctrl_chain, the conv stage can take the
+// next image while the pool and FC stages finish the current one.
 int forward(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]) {
-    
-    // Convolutional layer output buffer
-    float conv_output[CONV1_OUTPUT_CHANNELS][INPUT_HEIGHT][INPUT_WIDTH];
-    
-    // Convolutional layer operation
-    // Loop over output channels
-    convolutional_layer: for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
-        // Loop over input height
-        for (int h = 0; h < INPUT_HEIGHT; h++) {        
-
-            // Temporary buffer for input data (with padding)
-            // Kernel size is 3x3, with a 3-row buffer
-            float temp_input[3][INPUT_WIDTH+2][INPUT_CHANNELS]; 
-            
-            // Load the input data into the buffer with padding
-            // Load 3 rows of input data
-            for (int i = 0; i < 3; i++) { 
-                // Adjust row index for kernel centering
-                int curr_h = h + i - 1;  
-                // Input width with padding
-                for (int w = 0; w < INPUT_WIDTH + 2; w++) { 
-                    // Loop over input channels
-                    for (int c = 0; c < INPUT_CHANNELS; c++) {
-                        // Apply zero-padding for boundary conditions
-                        if (curr_h >= 0 && curr_h < INPUT_HEIGHT && w-1 >= 0 && w-1 < INPUT_WIDTH) {
-                            temp_input[i][w][c] = input[curr_h][w-1][c];
-                        } else {
-                            temp_input[i][w][c] = 0.0f;
-                        }
-                    }
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE ap_ctrl_chain port=return
+    #pragma HLS DATAFLOW
+
+    pipeline_stages(input, output PROFILE_NO_CLOCK_ARG);
+
+    return 0; // Success
+}
+
+// Classification-only forward pass: returns the CONVNET_TOP_K best classes instead of all the scores
+// top receives the (class, score) pairs by decreasing score; only the entries scoring at least
+// threshold are valid, the others have label -1. Pass -INFINITY to always get k classes.
+// Returns the number of valid entries (0 if no class reaches the threshold).
+int forward_topk(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float threshold,
+                 ClassScore top[CONVNET_TOP_K]) {
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE s_axilite port=threshold
+    #pragma HLS INTERFACE s_axilite port=top
+    #pragma HLS INTERFACE s_axilite port=return
+
+    run_topk_pipeline(input, threshold, top PROFILE_NO_CLOCK_ARG);
+
+    int count = 0;
+    for (int i = 0; i < CONVNET_TOP_K; i++) {
+        #pragma HLS UNROLL
+        count += top[i].label >= 0;
+    }
+    return count;
+}
+
+// Forward pass with run-time loadable weights
+// When reload is set, the weights (the payload of a weights file, same layout as ConvNet) are first
+// burst-read over the AXI master port into the on-chip weight memories, where they stay for the
+// following calls; then the image goes through the same pipeline as forward().
+int forward_weights(const float *weights, int reload,
+                    float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]) {
+    #pragma HLS INTERFACE m_axi port=weights offset=slave bundle=gmem0 depth=CONVNET_WEIGHT_COUNT
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE s_axilite port=reload
+    #pragma HLS INTERFACE s_axilite port=return
+
+    if (reload) {
+        memcpy(&convnet, weights, sizeof(ConvNet));
+#ifndef __SYNTHESIS__
+        convnet_params = &convnet;
+#endif
+    }
+    run_pipeline(input, output PROFILE_NO_CLOCK_ARG);
+
+    return 0; // Success
+}
+
+/*------------------------ Winograd convolution ------------------------*/
+
+#if INPUT_HEIGHT % 2 != 0 || INPUT_WIDTH % 2 != 0
+#error "The Winograd F(2x2, 3x3) convolution needs an even INPUT_HEIGHT and INPUT_WIDTH"
+#endif
+
+// Input transform of a 4x4 tile: v = B^T d B (additions only)
+static void winograd_input_transform(float d[4][4], float v[4][4]) {
+    #pragma HLS INLINE
+    float t[4][4];
+    for (int k = 0; k < 4; k++) {
+        t[0][k] = d[0][k] - d[2][k];
+        t[1][k] = d[1][k] + d[2][k];
+        t[2][k] = d[2][k] - d[1][k];
+        t[3][k] = d[1][k] - d[3][k];
+    }
+    for (int i = 0; i < 4; i++) {
+        v[i][0] = t[i][0] - t[i][2];
+        v[i][1] = t[i][1] + t[i][2];
+        v[i][2] = t[i][2] - t[i][1];
+        v[i][3] = t[i][1] - t[i][3];
+    }
+}
+
+// Output transform of a 4x4 product tile: y = A^T m A (additions only)
+static void winograd_output_transform(float m[4][4], float y[2][2]) {
+    #pragma HLS INLINE
+    float t[2][4];
+    for (int k = 0; k < 4; k++) {
+        t[0][k] = m[0][k] + m[1][k] + m[2][k];
+        t[1][k] = m[1][k] - m[2][k] - m[3][k];
+    }
+    for (int i = 0; i < 2; i++) {
+        y[i][0] = t[i][0] + t[i][1] + t[i][2];
+        y[i][1] = t[i][1] - t[i][2] - t[i][3];
+    }
+}
+
+// II of the Winograd tile loop: the CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 16 products of a tile
+// share a quarter as many multipliers, and a 2x2 output tile every 4 cycles is one output pixel per
+// cycle, the rate at which the input stream delivers the pixels
+#define WINOGRAD_TILE_II 4
+
+// Multiplies of the Winograd stage per image: 16 per 2x2 output tile and channel pair
+#define WINOGRAD_MULTIPLIES (INPUT_HEIGHT / 2 * INPUT_WIDTH / 2 * CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 16)
+
+// Tile rows of the image, each giving two output rows
+#define WINOGRAD_TILE_ROWS (INPUT_HEIGHT / 2)
+
+// Transforms the conv1 filters in use into the Winograd domain: u[oc][ic] = G g G^T
+// G only holds 0, 1 and 1/2, so this is additions and exact halvings. It is redone for every image
+// from CONVNET_PARAMS, so the Winograd path follows the weights loaded at run time like forward().
+static void winograd_filters(float u[CONV1_OUTPUT_CHANNELS][INPUT_CHANNELS][4][4]) {
+    #pragma HLS INLINE
+    for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+        for (int ic = 0; ic < INPUT_CHANNELS; ic++) {
+            #pragma HLS PIPELINE II=1
+            float g[3][3];
+            float t[4][3];
+            for (int i = 0; i < 3; i++) {
+                for (int k = 0; k < 3; k++) {
+                    g[i][k] = CONVNET_PARAMS.conv1.weights[oc][ic][i][k];
                 }
             }
-            
-            // Perform convolution for the current row of the output
-            for (int w = 0; w < INPUT_WIDTH; w++) {
-                // Initialize with bias value
-                float sum = convnet.conv1.biases[oc]; 
-                
-                // Convolve the kernel with the input buffer
-                // Loop over input channels
-                for (int ic = 0; ic < INPUT_CHANNELS; ic++) { 
-                    // Kernel height
-                    for (int kh = 0; kh < 3; kh++) {      
-                        // Kernel width    
-                        for (int kw = 0; kw < 3; kw++) {      
-                            sum += temp_input[kh][w + kw][ic] * convnet.conv1.weights[oc][ic][kh][kw];
-                        }
-                    }
+            for (int k = 0; k < 3; k++) {
+                t[0][k] = g[0][k];
+                t[1][k] = 0.5f * (g[0][k] + g[1][k] + g[2][k]);
+                t[2][k] = 0.5f * (g[0][k] - g[1][k] + g[2][k]);
+                t[3][k] = g[2][k];
+            }
+            for (int i = 0; i < 4; i++) {
+                u[oc][ic][i][0] = t[i][0];
+                u[oc][ic][i][1] = 0.5f * (t[i][0] + t[i][1] + t[i][2]);
+                u[oc][ic][i][2] = 0.5f * (t[i][0] - t[i][1] + t[i][2]);
+                u[oc][ic][i][3] = t[i][2];
+            }
+        }
+    }
+}
+
+// Line buffer of the Winograd stage: three pairs of input rows with a zero padding column on each
+// side. Pair k holds input rows 2k-1 and 2k (zero outside the image) and lives in slot k % 3, rows
+// 2 * (k % 3) and 2 * (k % 3) + 1: tile row t reads pairs t and t+1 while pair t+2 is being filled.
+#define WINOGRAD_PAIR_ROW(k, a) (2 * ((k) % 3) + (a))
+
+// Computes the two output rows of tile row t into tile_rows, and reads input rows 2t+3 and 2t+4
+// (pair t+2) into the line buffer meanwhile
+// Those 2 * INPUT_WIDTH pixels are read 4 per tile, in raster order, so the input stream delivers
+// one pixel per cycle of the WINOGRAD_TILE_II tile loop.
+static void winograd_tile_row(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], int t,
+                              float u[CONV1_OUTPUT_CHANNELS][INPUT_CHANNELS][4][4],
+                              float rows[6][INPUT_WIDTH + 2][INPUT_CHANNELS],
+                              float tile_rows[2][INPUT_WIDTH][CONV1_OUTPUT_CHANNELS]) {
+    #pragma HLS INLINE off
+    int tile_row[4];
+    for (int i = 0; i < 4; i++) {
+        tile_row[i] = WINOGRAD_PAIR_ROW(t + i / 2, i % 2);
+    }
+    int fill = t + 2 <= WINOGRAD_TILE_ROWS;
+
+    tile_loop: for (int j = 0; j < INPUT_WIDTH / 2; j++) {
+        #pragma HLS PIPELINE II=WINOGRAD_TILE_II
+        // The pair being filled is never the one being read
+        #pragma HLS DEPENDENCE variable=rows inter false
+        #pragma HLS DEPENDENCE variable=rows intra false
+        for (int q = 0; q < 4; q++) {
+            int p = 4 * j + q;
+            int a = p / INPUT_WIDTH;
+            int w = p % INPUT_WIDTH;
+            int r = 2 * t + 3 + a;
+            for (int c = 0; c < INPUT_CHANNELS; c++) {
+                if (fill) {
+                    rows[WINOGRAD_PAIR_ROW(t + 2, a)][w + 1][c] = r < INPUT_HEIGHT ? input[r][w][c] : 0.0f;
                 }
-                // Apply ReLU activation function
-                conv_output[oc][h][w] = reLu(sum); 
-            }
-        }
-    }
-
-    // MaxPooling layer output buffer
-    float pool_output[CONV1_OUTPUT_CHANNELS][INPUT_HEIGHT / POOL_SIZE][INPUT_WIDTH / POOL_SIZE];
-
-    // MaxPooling operation
-    // Loop over output channels
-    for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) { 
-        // Loop over pooled height
-        for (int h = 0; h < INPUT_HEIGHT / POOL_SIZE; h++) { 
-            // Loop over pooled width
-            for (int w = 0; w < INPUT_WIDTH / POOL_SIZE; w++) { 
-                // Initialize with a very small value
-                float max_val = -1e9; 
-                // Pooling window height
-                for (int ph = 0; ph < POOL_SIZE; ph++) { 
-                    // Pooling window width
-                    for (int pw = 0; pw < POOL_SIZE; pw++) { 
-                        // Calculate input height index
-                        int ih = h * POOL_SIZE + ph; 
-                        // Calculate input width index
-                        int iw = w * POOL_SIZE + pw; 
-                        // Ensure within bounds
-                        if (ih < INPUT_HEIGHT && iw < INPUT_WIDTH) { 
-                            // Find max value in window
-                            if (conv_output[oc][ih][iw] > max_val) { 
-                                max_val = conv_output[oc][ih][iw];
-                            }
-                        }
+            }
+        }
+
+        float v[INPUT_CHANNELS][4][4];
+        for (int ic = 0; ic < INPUT_CHANNELS; ic++) {
+            float d[4][4];
+            for (int i = 0; i < 4; i++) {
+                for (int k = 0; k < 4; k++) {
+                    d[i][k] = rows[tile_row[i]][2 * j + k][ic];
+                }
+            }
+            winograd_input_transform(d, v[ic]);
+        }
+        for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+            float m[4][4];
+            for (int i = 0; i < 4; i++) {
+                for (int k = 0; k < 4; k++) {
+                    m[i][k] = 0.0f;
+                    for (int ic = 0; ic < INPUT_CHANNELS; ic++) {
+                        m[i][k] += u[oc][ic][i][k] * v[ic][i][k];
                     }
                 }
-                // Store max value in pooled output
-                pool_output[oc][h][w] = max_val; 
+            }
+            float y[2][2];
+            winograd_output_transform(m, y);
+            for (int a = 0; a < 2; a++) {
+                for (int b = 0; b < 2; b++) {
+                    tile_rows[a][2 * j + b][oc] = reLu(y[a][b] + CONVNET_PARAMS.conv1.biases[oc]);
+                }
             }
         }
     }
+}
 
-    // Fully connected layer input buffer
-    float fc_input[FC1_INPUT_SIZE];
-    #pragma HLS ARRAY_PARTITION variable=fc_input complete
-
-    // Flatten pooling output into a 1D array
-    // Index for flattened array
-    int idx = 0; 
-    // Loop over output channels
-    flatten: for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) { 
-        // Loop over pooled height
-        for (int h = 0; h < INPUT_HEIGHT / POOL_SIZE; h++) { 
-            // Loop over pooled width
-            for (int w = 0; w < INPUT_WIDTH / POOL_SIZE; w++) { 
-                fc_input[idx++] = pool_output[oc][h][w];
+// Writes the two output rows of tile row t to conv_stream, in (h, w, oc) order, one pixel per cycle
+// like conv_row
+static void winograd_emit_rows(float tile_rows[2][INPUT_WIDTH][CONV1_OUTPUT_CHANNELS], int t,
+                               float conv_stream[CONV_STREAM_SIZE] PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE off
+    PROFILE_LOOP_BEGIN(wconv);
+    emit_rows: for (int a = 0; a < 2; a++) {
+        for (int w = 0; w < INPUT_WIDTH; w++) {
+            #pragma HLS PIPELINE II=1
+            PROFILE_ITERATION(wconv);
+            for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                conv_stream[((2 * t + a) * INPUT_WIDTH + w) * CONV1_OUTPUT_CHANNELS + oc] = tile_rows[a][w][oc];
             }
         }
     }
+    PROFILE_LOOP_END(wconv, 1);
+}
+
+// Convolution stage with Winograd F(2x2, 3x3): conv + ReLU, same output order as conv_stage()
+// Every 4x4 input tile gives a 2x2 output tile y = A^T [sum_ic U[oc][ic] .* (B^T d B)] A, with the
+// filters U = G g G^T of winograd_filters(). Only the element-wise products use multipliers: 16 per
+// output tile and channel pair, against 36 for the direct convolution. At WINOGRAD_TILE_II that is
+// CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 4 multipliers (12) for the 27 of conv_row, 2.25x fewer.
+// This is a resource saving, not a speedup: both convolutions take the input stream at one pixel
+// per cycle, and faster tiles would only wait for it. The input rows of the next tile row are read
+// while a tile row is computed, and the tile rows are computed into two buffers used in turn
+// (ping-pong), so the output rows of tile row t-1 are emitted while tile row t is computed. After
+// the first three input rows, every tile row takes 2 * INPUT_WIDTH cycles: about 920 cycles per
+// image against 841 for conv_stage, both under the CONV_STREAM_SIZE cycles of pool_stage.
+static void conv_winograd_stage(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],
+                                float conv_stream[CONV_STREAM_SIZE] PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE off
+    float u[CONV1_OUTPUT_CHANNELS][INPUT_CHANNELS][4][4];
+    float rows[6][INPUT_WIDTH + 2][INPUT_CHANNELS];
+    float ping[2][INPUT_WIDTH][CONV1_OUTPUT_CHANNELS];
+    float pong[2][INPUT_WIDTH][CONV1_OUTPUT_CHANNELS];
+    #pragma HLS ARRAY_PARTITION variable=u complete dim=0
+    #pragma HLS ARRAY_PARTITION variable=rows complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=rows cyclic factor=4 dim=2
+    #pragma HLS ARRAY_PARTITION variable=rows complete dim=3
+    #pragma HLS ARRAY_PARTITION variable=ping complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=ping cyclic factor=2 dim=2
+    #pragma HLS ARRAY_PARTITION variable=ping complete dim=3
+    #pragma HLS ARRAY_PARTITION variable=pong complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=pong cyclic factor=2 dim=2
+    #pragma HLS ARRAY_PARTITION variable=pong complete dim=3
+    PROFILE_START(wconv);
 
-    // Fully connected layer computation
-    // Loop over output classes
-    fully_connected_loop: for (int o = 0; o < NUM_CLASSES; o++) { 
-        // Initialize with bias value
-        float sum = convnet.fc1.biases[o]; 
+    winograd_filters(u);
+
+    // Zero padding above the image and on the sides, then input rows 0 to 2 (pairs 0 and 1)
+    for (int i = 0; i < 6; i++) {
+        for (int x = 0; x < INPUT_WIDTH + 2; x++) {
+            for (int c = 0; c < INPUT_CHANNELS; c++) {
+                rows[i][x][c] = 0.0f;
+            }
+        }
+    }
+    first_rows: for (int p = 0; p < 3 * INPUT_WIDTH; p++) {
         #pragma HLS PIPELINE II=1
-        // Loop over flattened input
-        for (int i = 0; i < FC1_INPUT_SIZE; i++) { 
-            // Weighted sum of inputs
-            sum += fc_input[i] * convnet.fc1.weights[o][i]; 
+        int r = p / INPUT_WIDTH;
+        int w = p % INPUT_WIDTH;
+        for (int c = 0; c < INPUT_CHANNELS; c++) {
+            rows[WINOGRAD_PAIR_ROW((r + 1) / 2, (r + 1) % 2)][w + 1][c] = input[r][w][c];
+        }
+    }
+
+    // One extra iteration emits the last tile row. Each iteration calls the tile row and the emit
+    // on different buffers, with no dependency between them, so HLS schedules them in parallel.
+    winograd_layer: for (int t = 0; t <= WINOGRAD_TILE_ROWS; t++) {
+        if (t % 2 == 0) {
+            if (t < WINOGRAD_TILE_ROWS) {
+                winograd_tile_row(input, t, u, rows, ping);
+            }
+            if (t > 0) {
+                winograd_emit_rows(pong, t - 1, conv_stream PROFILE_CLOCK_ARG);
+            }
+        } else {
+            if (t < WINOGRAD_TILE_ROWS) {
+                winograd_tile_row(input, t, u, rows, pong);
+            }
+            winograd_emit_rows(ping, t - 1, conv_stream PROFILE_CLOCK_ARG);
+        }
+    }
+
+    PROFILE_STOP(wconv);
+    PROFILE_ADD(wconv, macs, WINOGRAD_MULTIPLIES);
+    PROFILE_ADD(wconv, calls, 1);
+}
+
+// Winograd conv, pool and FC stages connected by FIFOs, inlined into the DATAFLOW region of the caller
+static void winograd_stages(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]
+                            PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE
+
+    float conv_stream[CONV_STREAM_SIZE];
+    float pool_stream[FC1_INPUT_SIZE];
+    #pragma HLS STREAM variable=conv_stream depth=2*INPUT_WIDTH*CONV1_OUTPUT_CHANNELS
+    #pragma HLS STREAM variable=pool_stream depth=POOL_WIDTH*CONV1_OUTPUT_CHANNELS
+
+    conv_winograd_stage(input, conv_stream PROFILE_CLOCK_ARG);
+    pool_stage(conv_stream, pool_stream PROFILE_CLOCK_ARG);
+    fc_stage(pool_stream, output PROFILE_CLOCK_ARG);
+}
+
+// Forward pass with the Winograd F(2x2, 3x3) convolution, otherwise the same pipeline as forward()
+// Use it as the top function instead of forward() where multipliers are the limit: the convolution
+// needs 2.25x fewer of them for the same image rate, set by pool_stage. It is not faster. The class
+// scores differ from forward() by float rounding only, on the compiled-in or the loaded weights.
+// Like forward(), the top function is the DATAFLOW region itself.
+int forward_winograd(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]) {
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE ap_ctrl_chain port=return
+    #pragma HLS DATAFLOW
+
+    winograd_stages(input, output PROFILE_NO_CLOCK_ARG);
+
+    return 0; // Success
+}
+
+/*------------------------ Sparse FC layer ------------------------*/
+
+#if CONVNET_SPARSE_LANES < 1 || CONVNET_SPARSE_LANES > 2
+#error "CONVNET_SPARSE_LANES must be 1 or 2"
+#endif
+
+// Stores the pooled values in the flattened (oc, h, w) order of the weights
+// The CSR tables of fc_sparse_stage() pick the kept inputs at random, so unlike fc_stage() it needs
+// the whole feature vector first. As its own dataflow stage the buffer becomes a ping-pong: the
+// next image is gathered while the FC works on the current one.
+static void fc_gather_stage(float pool_stream[FC1_INPUT_SIZE], float features[FC1_INPUT_SIZE]) {
+    #pragma HLS INLINE off
+    int in_idx = 0;
+    gather_loop: for (int h = 0; h < POOL_HEIGHT; h++) {
+        for (int w = 0; w < POOL_WIDTH; w++) {
+            for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                #pragma HLS PIPELINE II=1
+                features[(oc * POOL_HEIGHT + h) * POOL_WIDTH + w] = pool_stream[in_idx++];
+            }
+        }
+    }
+}
+
+// FC stage on the pruned weights of ConvNet_sparse_weights.h (pytorch/prune_weights.py), in CSR form
+// Each of the CONVNET_SPARSE_LANES lanes walks the kept weights of one class, one MAC per cycle,
+// so a group of classes takes as many cycles as its largest row. Consecutive weights of a class go
+// to FC_ACCUMULATORS interleaved partial sums, as in fc_accumulate(). Every lane reads the
+// weights, the indices and the features at its own address: two lanes use the two ports of those
+// memories, more would need them replicated.
+// This saves memory and multipliers, not time: at the exported ratio 0.3 it takes about 2140 cycles
+// per image on 2 multipliers, against 588 for fc_stage() on NUM_CLASSES. It stays under the
+// CONV_STREAM_SIZE cycles of pool_stage, so the pipeline keeps its rate; with one lane it would
+// take CONVNET_SPARSE_FC1_NNZ (4116) and become the slowest stage.
+static void fc_sparse_stage(float features[FC1_INPUT_SIZE], float output[NUM_CLASSES] PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE off
+    float partial[CONVNET_SPARSE_LANES][FC_ACCUMULATORS];
+    #pragma HLS ARRAY_PARTITION variable=partial complete dim=0
+    PROFILE_START(sfc);
+
+    sparse_groups: for (int o = 0; o < NUM_CLASSES; o += CONVNET_SPARSE_LANES) {
+        int first[CONVNET_SPARSE_LANES];
+        int nnz[CONVNET_SPARSE_LANES];
+        int group_nnz = 0;
+        for (int l = 0; l < CONVNET_SPARSE_LANES; l++) {
+            #pragma HLS UNROLL
+            int row = o + l < NUM_CLASSES ? o + l : NUM_CLASSES - 1;
+            first[l] = convnet_sparse_fc1_row_ptr[row];
+            nnz[l] = o + l < NUM_CLASSES ? convnet_sparse_fc1_row_ptr[row + 1] - first[l] : 0;
+            group_nnz = nnz[l] > group_nnz ? nnz[l] : group_nnz;
+            partial[l][0] = CONVNET_PARAMS.fc1.biases[row];
+            for (int a = 1; a < FC_ACCUMULATORS; a++) {
+                partial[l][a] = 0.0f;
+            }
+        }
+
+        PROFILE_LOOP_BEGIN(sfc);
+        sparse_loop: for (int n = 0; n < group_nnz; n++) {
+            #pragma HLS LOOP_TRIPCOUNT min=0 max=FC1_INPUT_SIZE
+            #pragma HLS PIPELINE II=1
+            #pragma HLS DEPENDENCE variable=partial inter distance=FC_ACCUMULATORS true
+            PROFILE_ITERATION(sfc);
+            for (int l = 0; l < CONVNET_SPARSE_LANES; l++) {
+                if (n < nnz[l]) {
+                    int k = first[l] + n;
+                    partial[l][n % FC_ACCUMULATORS] += convnet_sparse_fc1_values[k] * features[convnet_sparse_fc1_col_idx[k]];
+                }
+            }
+        }
+
+        for (int l = 0; l < CONVNET_SPARSE_LANES && o + l < NUM_CLASSES; l++) {
+            #pragma HLS UNROLL
+            output[o + l] = fc_reduce(partial[l]);
+        }
+        PROFILE_LOOP_END(sfc, 1);
+    }
+
+    PROFILE_STOP(sfc);
+    PROFILE_ADD(sfc, macs, CONVNET_SPARSE_FC1_NNZ);
+    PROFILE_ADD(sfc, calls, 1);
+}
+
+// Conv, pool and the sparse FC stages as a dataflow pipeline
+static void run_sparse_pipeline(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]
+                                PROFILE_CLOCK_PARAM) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    float conv_stream[CONV_STREAM_SIZE];
+    float pool_stream[FC1_INPUT_SIZE];
+    float features[FC1_INPUT_SIZE];
+    #pragma HLS STREAM variable=conv_stream depth=INPUT_WIDTH*CONV1_OUTPUT_CHANNELS
+    #pragma HLS STREAM variable=pool_stream depth=POOL_WIDTH*CONV1_OUTPUT_CHANNELS
+
+    conv_stage(input, conv_stream PROFILE_CLOCK_ARG);
+    pool_stage(conv_stream, pool_stream PROFILE_CLOCK_ARG);
+    fc_gather_stage(pool_stream, features);
+    fc_sparse_stage(features, output PROFILE_CLOCK_ARG);
+}
+
+#ifndef __SYNTHESIS__
+// Whether the kept weights of the CSR tables are those of the FC layer in use
+// The tables are compiled in, so weights mapped or reloaded since then can leave them stale.
+static int sparse_tables_current(void) {
+    for (int o = 0; o < NUM_CLASSES; o++) {
+        for (int k = convnet_sparse_fc1_row_ptr[o]; k < convnet_sparse_fc1_row_ptr[o + 1]; k++) {
+            if (convnet_sparse_fc1_values[k] != CONVNET_PARAMS.fc1.weights[o][convnet_sparse_fc1_col_idx[k]]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+#endif
+
+// Forward pass with the pruned FC layer, otherwise the same pipeline as forward()
+// Use it as the top function instead of forward() to trade the NUM_CLASSES parallel FC multipliers
+// and the dense weight ROM for CONVNET_SPARSE_LANES multipliers and CONVNET_SPARSE_FC1_NNZ weights,
+// plus a ping-pong feature buffer. It is slower than forward() per image (see fc_sparse_stage()).
+// The pruned weights are compiled in: returns -1 without computing anything when the FC weights in
+// use are not the ones they were pruned from, or, on the FPGA, when the weights are not compiled in
+// (CONVNET_EXTERNAL_WEIGHTS), since nothing loads them in this top function.
+int forward_sparse(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]) {
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE ap_ctrl_chain port=return
+
+#ifdef __SYNTHESIS__
+#ifdef CONVNET_EXTERNAL_WEIGHTS
+    return -1;
+#endif
+#else
+    if (!sparse_tables_current()) {
+        return -1;
+    }
+#endif
+    run_sparse_pipeline(input, output PROFILE_NO_CLOCK_ARG);
+
+    return 0; // Success
+}
+
+/*------------------------ Batched ingestion ------------------------*/
+
+#define IMAGE_FLOATS (INPUT_HEIGHT * INPUT_WIDTH * INPUT_CHANNELS)
+
+// Burst-reads image k of the batch into an on-chip image buffer
+static void load_image(const float *images, int k, float buffer[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS]) {
+    #pragma HLS INLINE off
+    memcpy(buffer, images + k * IMAGE_FLOATS, sizeof(float) * IMAGE_FLOATS);
+}
+
+// Runs the pipeline on an image buffer and burst-writes its class scores
+static void compute_image(float buffer[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], int k, float *scores) {
+    #pragma HLS INLINE off
+    float output[NUM_CLASSES];
+    run_pipeline(buffer, output PROFILE_NO_CLOCK_ARG);
+    memcpy(scores + k * NUM_CLASSES, output, sizeof(output));
+}
+
+// Forward pass of a batch of n images (at most CONVNET_BATCH_MAX_IMAGES) read from memory
+// images holds n images in the layout of forward()'s input, scores receives NUM_CLASSES scores per image.
+// The loop body is a DATAFLOW region in the canonical for-loop form: buffer is a ping-pong (PIPO)
+// channel between load_image() and compute_image(), so image k+1 is burst-read into one half
+// while image k is convolved from the other, and the transfers are hidden behind the computation.
+// Returns 0 on success, -1 if n is out of range.
+int forward_batch(const float *images, int n, float *scores) {
+    #pragma HLS INTERFACE m_axi port=images offset=slave bundle=gmem0 depth=CONVNET_BATCH_MAX_IMAGES*IMAGE_FLOATS max_read_burst_length=256
+    #pragma HLS INTERFACE m_axi port=scores offset=slave bundle=gmem1 depth=CONVNET_BATCH_MAX_IMAGES*NUM_CLASSES
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=return
+
+    if (n < 0 || n > CONVNET_BATCH_MAX_IMAGES) {
+        return -1;
+    }
+    image_loop: for (int k = 0; k < n; k++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=CONVNET_BATCH_MAX_IMAGES
+        #pragma HLS DATAFLOW
+        float buffer[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS];
+        #pragma HLS STREAM variable=buffer type=pipo depth=2
+        load_image(images, k, buffer);
+        compute_image(buffer, k, scores);
+    }
+
+    return 0; // Success
+}
+
+/*------------------------ Multi-unit dispatch ------------------------*/
+
+#if CONVNET_DISPATCH_UNITS < 1 || CONVNET_DISPATCH_UNITS > 4
+#error "CONVNET_DISPATCH_UNITS must be 1 to 4"
+#endif
+
+#define UNIT_IMAGES ((CONVNET_DISPATCH_MAX_IMAGES + CONVNET_DISPATCH_UNITS - 1) / CONVNET_DISPATCH_UNITS)
+
+// Deals the images round-robin to the input FIFOs of the units: image i goes to unit
+// i % CONVNET_DISPATCH_UNITS. The unit loop is unrolled, so every FIFO is addressed with a constant.
+static void dispatch_read(const float *images, int n,
+                          float unit_in[CONVNET_DISPATCH_UNITS][UNIT_IMAGES * IMAGE_FLOATS]) {
+    #pragma HLS INLINE off
+    int rounds = (n + CONVNET_DISPATCH_UNITS - 1) / CONVNET_DISPATCH_UNITS;
+    read_loop: for (int r = 0; r < rounds; r++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=UNIT_IMAGES
+        for (int u = 0; u < CONVNET_DISPATCH_UNITS; u++) {
+            #pragma HLS UNROLL
+            int image = r * CONVNET_DISPATCH_UNITS + u;
+            if (image < n) {
+                for (int p = 0; p < IMAGE_FLOATS; p++) {
+                    #pragma HLS PIPELINE II=1
+                    unit_in[u][r * IMAGE_FLOATS + p] = images[image * IMAGE_FLOATS + p];
+                }
+            }
+        }
+    }
+}
+
+// One compute unit: its own conv/pool/FC pipeline, classifying the images dealt to unit u
+static void dispatch_unit(float in[UNIT_IMAGES * IMAGE_FLOATS], int n, int u,
+                          float out[UNIT_IMAGES * NUM_CLASSES]) {
+    #pragma HLS INLINE off
+    int count = (n - u + CONVNET_DISPATCH_UNITS - 1) / CONVNET_DISPATCH_UNITS;
+
+    unit_loop: for (int i = 0; i < count; i++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=UNIT_IMAGES
+        float image[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS];
+        float scores[NUM_CLASSES];
+        for (int h = 0; h < INPUT_HEIGHT; h++) {
+            for (int w = 0; w < INPUT_WIDTH; w++) {
+                for (int c = 0; c < INPUT_CHANNELS; c++) {
+                    #pragma HLS PIPELINE II=1
+                    image[h][w][c] = in[i * IMAGE_FLOATS + (h * INPUT_WIDTH + w) * INPUT_CHANNELS + c];
+                }
+            }
+        }
+        run_pipeline(image, scores PROFILE_NO_CLOCK_ARG);
+        for (int o = 0; o < NUM_CLASSES; o++) {
+            #pragma HLS PIPELINE II=1
+            out[i * NUM_CLASSES + o] = scores[o];
+        }
+    }
+}
+
+// Reads the score FIFOs in the same round-robin order, so the scores come out in input order
+static void dispatch_collect(float unit_out[CONVNET_DISPATCH_UNITS][UNIT_IMAGES * NUM_CLASSES], int n,
+                             float *scores) {
+    #pragma HLS INLINE off
+    int rounds = (n + CONVNET_DISPATCH_UNITS - 1) / CONVNET_DISPATCH_UNITS;
+    collect_loop: for (int r = 0; r < rounds; r++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=UNIT_IMAGES
+        for (int u = 0; u < CONVNET_DISPATCH_UNITS; u++) {
+            #pragma HLS UNROLL
+            int image = r * CONVNET_DISPATCH_UNITS + u;
+            if (image < n) {
+                for (int o = 0; o < NUM_CLASSES; o++) {
+                    #pragma HLS PIPELINE II=1
+                    scores[image * NUM_CLASSES + o] = unit_out[u][r * NUM_CLASSES + o];
+                }
+            }
+        }
+    }
+}
+
+// Reader, units and collector as a dataflow region
+static void run_dispatch(const float *images, int n, float *scores) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    float unit_in[CONVNET_DISPATCH_UNITS][UNIT_IMAGES * IMAGE_FLOATS];
+    float unit_out[CONVNET_DISPATCH_UNITS][UNIT_IMAGES * NUM_CLASSES];
+    #pragma HLS ARRAY_PARTITION variable=unit_in complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=unit_out complete dim=1
+    #pragma HLS STREAM variable=unit_in depth=IMAGE_FLOATS
+    #pragma HLS STREAM variable=unit_out depth=NUM_CLASSES
+
+    dispatch_read(images, n, unit_in);
+    // one call per unit, so HLS instantiates a separate pipeline for each
+    dispatch_unit(unit_in[0], n, 0, unit_out[0]);
+#if CONVNET_DISPATCH_UNITS > 1
+    dispatch_unit(unit_in[1], n, 1, unit_out[1]);
+#endif
+#if CONVNET_DISPATCH_UNITS > 2
+    dispatch_unit(unit_in[2], n, 2, unit_out[2]);
+#endif
+#if CONVNET_DISPATCH_UNITS > 3
+    dispatch_unit(unit_in[3], n, 3, unit_out[3]);
+#endif
+    dispatch_collect(unit_out, n, scores);
+}
+
+// Forward pass of n images (at most CONVNET_DISPATCH_MAX_IMAGES) on CONVNET_DISPATCH_UNITS copies
+// of the pipeline running concurrently.
+// images holds n images in the layout of forward()'s input, scores receives NUM_CLASSES scores per
+// image. A reader stage deals the images to the units through FIFOs and a collector stage merges
+// the scores back in input order, so while one unit works on an image the next one is already
+// being loaded into another.
+// Returns -1 without reading images if n is not 0 to CONVNET_DISPATCH_MAX_IMAGES (the size of the
+// unit buffers), 0 otherwise.
+int forward_dispatch(const float *images, int n, float *scores) {
+    #pragma HLS INTERFACE m_axi port=images offset=slave bundle=gmem0 depth=CONVNET_DISPATCH_MAX_IMAGES*IMAGE_FLOATS
+    #pragma HLS INTERFACE m_axi port=scores offset=slave bundle=gmem1 depth=CONVNET_DISPATCH_MAX_IMAGES*NUM_CLASSES
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=return
+
+    if (n < 0 || n > CONVNET_DISPATCH_MAX_IMAGES) {
+        return -1;
+    }
+    run_dispatch(images, n, scores);
+
+    return 0; // Success
+}
+
+#ifdef CONVNET_PROFILE
+void convnet_profile_read(LayerCounters counters[CONVNET_PROFILE_STAGES]) {
+    counters[0] = profile_conv;
+    counters[1] = profile_wconv;
+    counters[2] = profile_pool;
+    counters[3] = profile_fc;
+    counters[4] = profile_sfc;
+}
+
+void convnet_profile_reset(void) {
+    LayerCounters zero = {0};
+    profile_conv = zero;
+    profile_wconv = zero;
+    profile_pool = zero;
+    profile_fc = zero;
+    profile_sfc = zero;
+}
+
+// Profiled forward pass: same as forward(), and exports the counters of all the stages, accumulated
+// since the last reset, as AXI-lite status registers
+// cycle_counter is a plain input wired to a free-running counter of the kernel clock, latched by
+// every stage at its start and end and at the iterations of its loop. The host reads profile_clock()
+// instead and ignores it (pass NULL).
+int forward_profiled(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES],
+                     LayerCounters counters[CONVNET_PROFILE_STAGES], const volatile uint64_t *cycle_counter) {
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE s_axilite port=counters
+    #pragma HLS INTERFACE ap_none port=cycle_counter
+    #pragma HLS INTERFACE s_axilite port=return
+
+    run_pipeline(input, output PROFILE_CLOCK_ARG);
+    convnet_profile_read(counters);
+
+    return 0; // Success
+}
+#endif
+
+#ifndef __SYNTHESIS__
+// Host-only forward pass fed row by row
+// next_row is called once per input row, in order, and must fill row with the pixels of row h.
+int forward_rows(ConvRowSource next_row, void *ctx, float output[NUM_CLASSES]) {
+    float conv_stream[CONV_STREAM_SIZE];
+    float pool_stream[FC1_INPUT_SIZE];
+    float row[INPUT_WIDTH][INPUT_CHANNELS];
+
+    ConvLineBuffer line_buffer;
+    conv_reset(&line_buffer);
+    for (int r = 0; r <= INPUT_HEIGHT; r++) {
+        if (r < INPUT_HEIGHT) {
+            next_row(r, row, ctx);
         }
-        // Store the computed class score
-        output[o] = sum; 
+        conv_push_row(&line_buffer, row, r, conv_stream);
     }
+    pool_stage(conv_stream, pool_stream);
+    fc_stage(pool_stream, output);
+
     return 0; // Success
-}
\ No newline at end of file
+}
+#endif
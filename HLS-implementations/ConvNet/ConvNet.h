@@ -1,14 +1,33 @@
 #ifndef CONVNET_H
 #define CONVNET_H
 
+#include <stdint.h>
+
 #define INPUT_HEIGHT 28            // Input height
 #define INPUT_WIDTH 28             // Input width
 #define INPUT_CHANNELS 1           // Input channels
 #define CONV1_OUTPUT_CHANNELS 3    // Number of filters in the first convolutional layer
 #define POOL_SIZE 2                // Kernel size for MaxPooling
 #define POOL_STRIDE 2              // Stride for MaxPooling
+#define POOL_HEIGHT (INPUT_HEIGHT / POOL_SIZE) // Pooled feature map height
+#define POOL_WIDTH (INPUT_WIDTH / POOL_SIZE)   // Pooled feature map width
 #define FC1_INPUT_SIZE (CONV1_OUTPUT_CHANNELS * (INPUT_HEIGHT / POOL_SIZE) * (INPUT_WIDTH / POOL_SIZE)) // Input size for the fully connected layer
 #define NUM_CLASSES 10             // Number of classes (final output)
+#ifndef FC_ACCUMULATORS
+#define FC_ACCUMULATORS 4          // Interleaved partial sums per class in the FC layer (power of two)
+#endif
+#define Q_ACT_FRAC_BITS 8          // Fractional bits of the int16 activations (quantized path)
+#ifndef CONVNET_DISPATCH_UNITS
+#define CONVNET_DISPATCH_UNITS 2   // Pipelines instantiated by forward_dispatch() (1 to 4)
+#endif
+#ifndef CONVNET_TOP_K
+#define CONVNET_TOP_K 3            // Classes returned by forward_topk() (1 to NUM_CLASSES)
+#endif
+#ifndef CONVNET_SPARSE_LANES
+#define CONVNET_SPARSE_LANES 2     // Classes computed in parallel by forward_sparse() (1 or 2, one per memory port)
+#endif
+#define CONVNET_DISPATCH_MAX_IMAGES 64 // Max images per forward_dispatch() call
+#define CONVNET_BATCH_MAX_IMAGES 1024  // Max images per forward_batch() call (depth of its AXI ports)
 
 /*------------------------ Data Structures ------------------------*/
 
@@ -30,8 +49,73 @@ typedef struct {
     FullyConnectedLayer fc1;       // Fully connected layer
 } ConvNet;
 
+// One entry of the top-k output of forward_topk()
+typedef struct {
+    int label;                     // Class, -1 if the entry is below the threshold
+    float score;                   // Class score (logit)
+} ClassScore;
+
+// Number of floats in the weights of the network (the fields of ConvNet, back to back)
+#define CONVNET_WEIGHT_COUNT (CONV1_OUTPUT_CHANNELS * (INPUT_CHANNELS * 3 * 3 + 1) + NUM_CLASSES * (FC1_INPUT_SIZE + 1))
+
+// Quantized counterparts: int8 weights with one scale per layer, biases in accumulator units
+typedef struct {
+    int8_t weights[CONV1_OUTPUT_CHANNELS][INPUT_CHANNELS][3][3]; // Quantized filters
+    int32_t biases[CONV1_OUTPUT_CHANNELS];                       // Quantized biases
+} QuantizedConvLayer;
+
+typedef struct {
+    int8_t weights[NUM_CLASSES][FC1_INPUT_SIZE]; // Quantized weights
+    int32_t biases[NUM_CLASSES];                 // Quantized biases
+} QuantizedFullyConnectedLayer;
+
+typedef struct {
+    QuantizedConvLayer conv1;               // First convolutional layer
+    QuantizedFullyConnectedLayer fc1;       // Fully connected layer
+} QuantizedConvNet;
+
+#ifdef CONVNET_PROFILE
+// Stages reported by the profiling counters (-DCONVNET_PROFILE), in pipeline order
+// There is no separate flatten stage: the FC stage reads the pooled values in the order they arrive.
+// wconv is the Winograd convolution of forward_winograd() and sfc the pruned FC of forward_sparse(),
+// counted apart from the dense ones.
+#define CONVNET_PROFILE_STAGES 5
+#define CONVNET_PROFILE_STAGE_NAMES {"conv", "wconv", "pool", "fc", "sfc"}
+
+// Counters of one stage, accumulated over all the images since the last reset
+typedef struct {
+    uint64_t calls;                // Images processed
+    uint64_t time;                 // Time spent: profile_clock() units on the host, kernel clock cycles on the FPGA
+    uint64_t stall_cycles;         // FPGA only: cycles the stage loop waited on an empty or full FIFO
+    uint64_t macs;                 // Multiply-accumulates
+} LayerCounters;
+#endif
+
 /*-------------------------- Functions ---------------------------*/
 
 int forward(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]);
+int forward_weights(const float *weights, int reload,
+                    float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]);
+int forward_topk(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float threshold,
+                 ClassScore top[CONVNET_TOP_K]);
+int forward_batch(const float *images, int n, float *scores);
+int forward_dispatch(const float *images, int n, float *scores);
+int forward_quantized(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]);
+int forward_winograd(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]);
+int forward_sparse(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]);
+
+#ifdef CONVNET_PROFILE
+int forward_profiled(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES],
+                     LayerCounters counters[CONVNET_PROFILE_STAGES], const volatile uint64_t *cycle_counter);
+void convnet_profile_read(LayerCounters counters[CONVNET_PROFILE_STAGES]);
+void convnet_profile_reset(void);
+#endif
+
+#ifndef __SYNTHESIS__
+// Host-only row source for forward_rows(): fills row with the pixels of input row h
+typedef void (*ConvRowSource)(int h, float row[INPUT_WIDTH][INPUT_CHANNELS], void *ctx);
+
+int forward_rows(ConvRowSource next_row, void *ctx, float output[NUM_CLASSES]);
+#endif
 
 #endif // CONVNET_H
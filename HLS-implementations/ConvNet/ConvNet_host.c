@@ -0,0 +1,164 @@
+#include "ConvNet_host.h"
+#include "../host/simd_kernels.h"
+#include "../host/weights_file.h"
+#ifdef CONVNET_PROFILE
+#include "../host/profile_clock.h"
+#endif
+#include <string.h>
+
+// Tensors of a weights file, in the order of the ConvNet fields
+static const WeightsTensorSpec convnet_tensors[] = {
+    {"conv1.weight", 4, {CONV1_OUTPUT_CHANNELS, INPUT_CHANNELS, 3, 3}},
+    {"conv1.bias", 1, {CONV1_OUTPUT_CHANNELS}},
+    {"fc1.weight", 2, {NUM_CLASSES, FC1_INPUT_SIZE}},
+    {"fc1.bias", 1, {NUM_CLASSES}}
+};
+
+// The payload is used as a ConvNet structure, which is only possible without padding
+_Static_assert(sizeof(ConvNet) == CONVNET_WEIGHT_COUNT * sizeof(float), "ConvNet must be a packed array of floats");
+
+static WeightsFile mapped_weights;
+
+int convnet_map_weights(const char *path) {
+    WeightsFile file;
+    if (weights_file_open(path, convnet_tensors, sizeof(convnet_tensors) / sizeof(convnet_tensors[0]), &file) != 0) {
+        return -1;
+    }
+    convnet_unmap_weights();
+    mapped_weights = file;
+    convnet_params = (const ConvNet *)mapped_weights.payload;
+    return 0;
+}
+
+void convnet_unmap_weights(void) {
+    convnet_params = &convnet;
+    weights_file_close(&mapped_weights);
+}
+
+int convnet_load_weights(const char *path) {
+    if (convnet_map_weights(path) != 0) {
+        return -1;
+    }
+    memcpy(&convnet, convnet_params, sizeof(ConvNet));
+    convnet_unmap_weights();
+    return 0;
+}
+
+// Index of the highest class score
+static int argmax(const float output[NUM_CLASSES]) {
+    int predicted_label = 0;
+    for (int i = 1; i < NUM_CLASSES; i++) {
+        if (output[i] > output[predicted_label]) {
+            predicted_label = i;
+        }
+    }
+    return predicted_label;
+}
+
+int convnet_classify_image(const void *image, void *scratch) {
+    float *output = scratch;
+    forward((float (*)[INPUT_WIDTH][INPUT_CHANNELS])image, output);
+    return argmax(output);
+}
+
+int convnet_classify_batch(const void *images, int count, int *predictions, void *scratch) {
+    float *scores = scratch;
+    if (forward_batch(images, count, scores) != 0) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        predictions[i] = argmax(&scores[i * NUM_CLASSES]);
+    }
+    return 0;
+}
+
+int convnet_classify_dispatch(const void *images, int count, int *predictions, void *scratch) {
+    float *scores = scratch;
+    if (forward_dispatch(images, count, scores) != 0) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        predictions[i] = argmax(&scores[i * NUM_CLASSES]);
+    }
+    return 0;
+}
+
+// Convolution and pooling on the SIMD kernels
+// pool_output receives the pooled feature map, already in the flattened (oc, h, w) order of the FC weights.
+static void conv_pool_simd(const float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],
+                           float pool_output[CONV1_OUTPUT_CHANNELS][POOL_HEIGHT][POOL_WIDTH]) {
+    float padded[SIMD_CONV3X3_SCRATCH(INPUT_HEIGHT, INPUT_WIDTH, INPUT_CHANNELS)];
+    float conv_output[CONV1_OUTPUT_CHANNELS][INPUT_HEIGHT][INPUT_WIDTH];
+
+    simd_conv3x3_relu(&input[0][0][0], INPUT_HEIGHT, INPUT_WIDTH, INPUT_CHANNELS,
+                      &convnet_params->conv1.weights[0][0][0][0], convnet_params->conv1.biases, CONV1_OUTPUT_CHANNELS,
+                      &conv_output[0][0][0], padded);
+
+    for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+        for (int h = 0; h < POOL_HEIGHT; h++) {
+            for (int w = 0; w < POOL_WIDTH; w++) {
+                float max_val = conv_output[oc][h * POOL_SIZE][w * POOL_SIZE];
+                for (int ph = 0; ph < POOL_SIZE; ph++) {
+                    for (int pw = 0; pw < POOL_SIZE; pw++) {
+                        float val = conv_output[oc][h * POOL_SIZE + ph][w * POOL_SIZE + pw];
+                        if (val > max_val) {
+                            max_val = val;
+                        }
+                    }
+                }
+                pool_output[oc][h][w] = max_val;
+            }
+        }
+    }
+}
+
+int convnet_forward_simd(const float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]) {
+    float pool_output[CONV1_OUTPUT_CHANNELS][POOL_HEIGHT][POOL_WIDTH];
+    conv_pool_simd(input, pool_output);
+    simd_dense(&convnet_params->fc1.weights[0][0], convnet_params->fc1.biases, &pool_output[0][0][0], output,
+               FC1_INPUT_SIZE, NUM_CLASSES, 0);
+    return 0;
+}
+
+int convnet_classify_image_simd(const void *image, void *scratch) {
+    float *output = scratch;
+    convnet_forward_simd(image, output);
+    return argmax(output);
+}
+
+int convnet_prune(double ratio, SparseLayer *fc1) {
+    return sparse_layer_prune(&convnet_params->fc1.weights[0][0], NUM_CLASSES, FC1_INPUT_SIZE, ratio, fc1);
+}
+
+int convnet_forward_sparse(const float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], const SparseLayer *fc1,
+                           float output[NUM_CLASSES]) {
+    float pool_output[CONV1_OUTPUT_CHANNELS][POOL_HEIGHT][POOL_WIDTH];
+    conv_pool_simd(input, pool_output);
+    sparse_layer_forward(fc1, convnet_params->fc1.biases, &pool_output[0][0][0], output, 0);
+    return argmax(output);
+}
+
+int convnet_classify_image_winograd(const void *image, void *scratch) {
+    float *output = scratch;
+    forward_winograd((float (*)[INPUT_WIDTH][INPUT_CHANNELS])image, output);
+    return argmax(output);
+}
+
+#ifdef CONVNET_PROFILE
+void convnet_profile_print(FILE *out) {
+    static const char *const names[CONVNET_PROFILE_STAGES] = CONVNET_PROFILE_STAGE_NAMES;
+    LayerCounters counters[CONVNET_PROFILE_STAGES];
+    convnet_profile_read(counters);
+
+    uint64_t total = 0;
+    for (int s = 0; s < CONVNET_PROFILE_STAGES; s++) {
+        total += counters[s].time;
+    }
+    fprintf(out, "%-6s %10s %7s %16s %12s\n", "stage", "images", "time", PROFILE_CLOCK_UNIT "/image", "MACs/image");
+    for (int s = 0; s < CONVNET_PROFILE_STAGES; s++) {
+        double calls = counters[s].calls ? (double)counters[s].calls : 1.0;
+        fprintf(out, "%-6s %10llu %6.1f%% %16.1f %12.0f\n", names[s], (unsigned long long)counters[s].calls,
+                total ? 100.0 * counters[s].time / total : 0.0, counters[s].time / calls, counters[s].macs / calls);
+    }
+}
+#endif
@@ -0,0 +1,65 @@
+#ifndef CONVNET_HOST_H
+#define CONVNET_HOST_H
+
+#include "ConvNet.h"
+#include "../host/sparse_layer.h"
+#include <stdio.h>
+
+// Host-side glue between the ConvNet and the tools in ../host (testbench and CPU runs only, not synthesized)
+
+#define CONVNET_SCRATCH_SIZE (NUM_CLASSES * sizeof(float)) // Per-worker scratch: the class scores
+#define CONVNET_BATCH_SCRATCH_SIZE (CONVNET_BATCH_MAX_IMAGES * CONVNET_SCRATCH_SIZE) // Scratch of the batch kernels
+
+extern ConvNet convnet;          // network weights, defined in ConvNet.c
+extern const ConvNet *convnet_params; // weights used by the host build (&convnet or a mapped weights file)
+extern const double convnet_sparse_ratio; // pruning ratio of the FC layer of forward_sparse() (ConvNet_sparse_weights.h)
+
+/*-------------------------- Functions ---------------------------*/
+
+// Memory-maps a weights file (pytorch/export_weights_bin.py) and makes the network use it in place
+// Returns 0 on success, -1 if the file is missing or does not match the compiled network.
+int convnet_map_weights(const char *path);
+
+// Unmaps the file and goes back to the compiled-in weights
+void convnet_unmap_weights(void);
+
+// Copies a weights file into the weight tables of convnet, as the reload of forward_weights() does
+// on the FPGA. -DCONVNET_EXTERNAL_WEIGHTS builds have no weights until this is done.
+// Returns 0 on success, -1 if the file is missing or does not match the compiled network.
+int convnet_load_weights(const char *path);
+
+// ClassifyFn for the inference pool: sample points to one INPUT_HEIGHT x INPUT_WIDTH x INPUT_CHANNELS image,
+// scratch to CONVNET_SCRATCH_SIZE bytes
+int convnet_classify_image(const void *image, void *scratch);
+
+// Batch kernels of the benchmark: classify count images with one forward_batch() (at most
+// CONVNET_BATCH_MAX_IMAGES) or forward_dispatch() (at most CONVNET_DISPATCH_MAX_IMAGES) call,
+// scratch to CONVNET_BATCH_SCRATCH_SIZE bytes
+int convnet_classify_batch(const void *images, int count, int *predictions, void *scratch);
+int convnet_classify_dispatch(const void *images, int count, int *predictions, void *scratch);
+
+// CPU forward pass on the vectorized kernels of ../host/simd_kernels.h, same interface as forward()
+int convnet_forward_simd(const float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]);
+
+// ClassifyFn running convnet_forward_simd(), scratch as for convnet_classify_image()
+int convnet_classify_image_simd(const void *image, void *scratch);
+
+// Magnitude-prunes the FC layer of the weights in use at ratio into fc1 (see ../host/sparse_layer.h)
+// Returns 0 on success, -1 if the memory could not be allocated.
+int convnet_prune(double ratio, SparseLayer *fc1);
+
+// CPU forward pass with the pruned FC layer (convolution and pooling as convnet_forward_simd()),
+// returns the predicted class
+int convnet_forward_sparse(const float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], const SparseLayer *fc1,
+                           float output[NUM_CLASSES]);
+
+// ClassifyFn running forward_winograd(), scratch as for convnet_classify_image()
+int convnet_classify_image_winograd(const void *image, void *scratch);
+
+#ifdef CONVNET_PROFILE
+// Prints the host profiling counters of the stages: share of the measured time, and measured time
+// and MACs per image
+void convnet_profile_print(FILE *out);
+#endif
+
+#endif // CONVNET_HOST_H
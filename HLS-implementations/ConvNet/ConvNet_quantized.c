@@ -0,0 +1,192 @@
+#include "ConvNet.h"
+#include "ConvNet_quantized_weights.h"
+
+// Quantized forward pass: int8 weights with one scale per layer, int16 activations with
+// Q_ACT_FRAC_BITS fractional bits, int32 convolution and int64 FC accumulators. The tables in ConvNet_quantized_weights.h
+// are generated from pytorch/convnet_weights.txt by pytorch/quantize_weights.py.
+
+// Convert a float pixel to an int16 activation
+static int16_t quantize(float x) {
+    #pragma HLS INLINE
+    float scaled = x * (1 << Q_ACT_FRAC_BITS);
+    if (scaled >= INT16_MAX) return INT16_MAX;
+    if (scaled <= INT16_MIN) return INT16_MIN;
+    return (int16_t)(scaled + (scaled >= 0 ? 0.5f : -0.5f));
+}
+
+// Scale an accumulator back to an int16 activation (acc * mult / 2^shift) and apply ReLU
+static int16_t requantize_relu(int32_t acc, int32_t mult, int shift) {
+    #pragma HLS INLINE
+    int64_t scaled = ((int64_t)acc * mult + ((int64_t)1 << (shift - 1))) >> shift;
+    if (scaled < 0) return 0;
+    if (scaled > INT16_MAX) return INT16_MAX;
+    return (int16_t)scaled;
+}
+
+// One pixel of a quantized feature map, all channels
+// The quantized stages exchange whole pixels: every FIFO access moves CONV1_OUTPUT_CHANNELS int16
+// values, so each stage handles a pixel per cycle where the float pipeline handles a value.
+typedef struct {
+    int16_t c[CONV1_OUTPUT_CHANNELS];
+} QuantizedPixel;
+
+// Convolution stage: quantizes the input as it arrives, conv + ReLU through a line buffer like
+// conv_push_row(), one output pixel per cycle in (h, w) order
+static void q_conv_stage(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],
+                         QuantizedPixel conv_stream[INPUT_HEIGHT * INPUT_WIDTH]) {
+    #pragma HLS INLINE off
+    #pragma HLS ARRAY_PARTITION variable=convnet_quantized.conv1.weights complete dim=0
+    int16_t rows[2][INPUT_WIDTH][INPUT_CHANNELS];  // rows[0] = row r-2, rows[1] = row r-1
+    int16_t window[3][3][INPUT_CHANNELS];          // window[kh][kw], column 2 is the newest
+    #pragma HLS ARRAY_PARTITION variable=rows complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=window complete dim=0
+
+    // The rows above the image are zero padding
+    for (int i = 0; i < 2; i++) {
+        for (int w = 0; w < INPUT_WIDTH; w++) {
+            for (int c = 0; c < INPUT_CHANNELS; c++) {
+                rows[i][w][c] = 0;
+            }
+        }
+    }
+
+    // One extra row and column for the bottom and right zero padding
+    convolutional_layer: for (int r = 0; r <= INPUT_HEIGHT; r++) {
+        // Left zero-padding column
+        for (int kh = 0; kh < 3; kh++) {
+            for (int kw = 0; kw < 3; kw++) {
+                for (int c = 0; c < INPUT_CHANNELS; c++) {
+                    window[kh][kw][c] = 0;
+                }
+            }
+        }
+        conv_row: for (int w = 0; w <= INPUT_WIDTH; w++) {
+            #pragma HLS PIPELINE II=1
+            for (int c = 0; c < INPUT_CHANNELS; c++) {
+                for (int kh = 0; kh < 3; kh++) {
+                    window[kh][0][c] = window[kh][1][c];
+                    window[kh][1][c] = window[kh][2][c];
+                }
+                if (w < INPUT_WIDTH) {
+                    int16_t pixel = r < INPUT_HEIGHT ? quantize(input[r][w][c]) : 0;
+                    window[0][2][c] = rows[0][w][c];
+                    window[1][2][c] = rows[1][w][c];
+                    window[2][2][c] = pixel;
+                    rows[0][w][c] = rows[1][w][c];
+                    rows[1][w][c] = pixel;
+                } else {
+                    window[0][2][c] = 0;
+                    window[1][2][c] = 0;
+                    window[2][2][c] = 0;
+                }
+            }
+
+            // The window is centered on pixel (r-1, w-1): compute all output channels for it
+            if (r > 0 && w > 0) {
+                QuantizedPixel out;
+                for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                    int32_t sum = convnet_quantized.conv1.biases[oc];
+                    for (int ic = 0; ic < INPUT_CHANNELS; ic++) {
+                        for (int kh = 0; kh < 3; kh++) {
+                            for (int kw = 0; kw < 3; kw++) {
+                                sum += window[kh][kw][ic] * convnet_quantized.conv1.weights[oc][ic][kh][kw];
+                            }
+                        }
+                    }
+                    out.c[oc] = requantize_relu(sum, Q_CONV1_MULT, Q_CONV1_SHIFT);
+                }
+                conv_stream[(r - 1) * INPUT_WIDTH + (w - 1)] = out;
+            }
+        }
+    }
+}
+
+// MaxPooling stage: keeps the running maxima of one row of windows, emits a pooled pixel as soon
+// as its window is complete
+static void q_pool_stage(QuantizedPixel conv_stream[INPUT_HEIGHT * INPUT_WIDTH],
+                         QuantizedPixel pool_stream[POOL_HEIGHT * POOL_WIDTH]) {
+    #pragma HLS INLINE off
+    QuantizedPixel row_max[POOL_WIDTH];
+
+    int in_idx = 0;
+    int out_idx = 0;
+    max_pooling: for (int h = 0; h < INPUT_HEIGHT; h++) {
+        for (int w = 0; w < INPUT_WIDTH; w++) {
+            #pragma HLS PIPELINE II=1
+            QuantizedPixel px = conv_stream[in_idx++];
+            int pw = w / POOL_SIZE;
+            int first = h % POOL_SIZE == 0 && w % POOL_SIZE == 0;
+            QuantizedPixel max = row_max[pw];
+            for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                if (first || px.c[oc] > max.c[oc]) {
+                    max.c[oc] = px.c[oc];
+                }
+            }
+            row_max[pw] = max;
+            if (h % POOL_SIZE == POOL_SIZE - 1 && w % POOL_SIZE == POOL_SIZE - 1) {
+                pool_stream[out_idx++] = max;
+            }
+        }
+    }
+}
+
+// Fully connected stage: multiplies every pooled pixel into all the class scores on the fly
+// The weight ROM is reshaped so one read returns the weights of all the classes, and split in
+// CONV1_OUTPUT_CHANNELS blocks so the channels of a pixel, (oc * POOL_HEIGHT + h) * POOL_WIDTH + w
+// in the flattened PyTorch order, are read from different blocks in the same cycle.
+// Integer additions take one cycle, so a single accumulator per class keeps II=1. It is 64-bit:
+// FC1_INPUT_SIZE products of an int16 activation and an int8 weight can exceed the int32 range.
+static void q_fc_stage(QuantizedPixel pool_stream[POOL_HEIGHT * POOL_WIDTH], float output[NUM_CLASSES]) {
+    #pragma HLS INLINE off
+    #pragma HLS ARRAY_RESHAPE variable=convnet_quantized.fc1.weights complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=convnet_quantized.fc1.weights block factor=CONV1_OUTPUT_CHANNELS dim=2
+    int64_t sum[NUM_CLASSES];
+    #pragma HLS ARRAY_PARTITION variable=sum complete
+
+    for (int o = 0; o < NUM_CLASSES; o++) {
+        #pragma HLS UNROLL
+        sum[o] = convnet_quantized.fc1.biases[o];
+    }
+
+    int in_idx = 0;
+    fully_connected_loop: for (int h = 0; h < POOL_HEIGHT; h++) {
+        for (int w = 0; w < POOL_WIDTH; w++) {
+            #pragma HLS PIPELINE II=1
+            QuantizedPixel px = pool_stream[in_idx++];
+            for (int o = 0; o < NUM_CLASSES; o++) {
+                for (int oc = 0; oc < CONV1_OUTPUT_CHANNELS; oc++) {
+                    sum[o] += px.c[oc] * convnet_quantized.fc1.weights[o][(oc * POOL_HEIGHT + h) * POOL_WIDTH + w];
+                }
+            }
+        }
+    }
+
+    // Convert the accumulators back to float class scores
+    for (int o = 0; o < NUM_CLASSES; o++) {
+        output[o] = (float)sum[o] * Q_FC1_SCALE / (1 << Q_ACT_FRAC_BITS);
+    }
+}
+
+// Quantized forward pass function
+// Same dataflow structure as forward(): convolution + ReLU through a line buffer, max-pooling and
+// fully connected layer connected by FIFOs, the class scores are converted back to float at the
+// very end. The FIFOs carry whole pixels, so the stages take INPUT_HEIGHT * INPUT_WIDTH (784),
+// POOL_HEIGHT * POOL_WIDTH (196) and (INPUT_HEIGHT + 1) * (INPUT_WIDTH + 1) (841) cycles per image:
+// the conv stage sets about 840 cycles per image, against the CONV_STREAM_SIZE (2352) cycles of
+// the pooling stage of forward().
+int forward_quantized(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], float output[NUM_CLASSES]) {
+    #pragma HLS INTERFACE axis port=input
+    #pragma HLS INTERFACE ap_ctrl_chain port=return
+    #pragma HLS DATAFLOW
+
+    QuantizedPixel conv_stream[INPUT_HEIGHT * INPUT_WIDTH];
+    QuantizedPixel pool_stream[POOL_HEIGHT * POOL_WIDTH];
+    #pragma HLS STREAM variable=conv_stream depth=INPUT_WIDTH
+    #pragma HLS STREAM variable=pool_stream depth=POOL_WIDTH
+
+    q_conv_stage(input, conv_stream);
+    q_pool_stage(conv_stream, pool_stream);
+    q_fc_stage(pool_stream, output);
+
+    return 0; // Success
+}
@@ -0,0 +1,39 @@
+// Generated by pytorch/quantize_weights.py from pytorch/convnet_weights.txt, do not edit.
+#ifndef CONVNET_QUANTIZED_WEIGHTS_H
+#define CONVNET_QUANTIZED_WEIGHTS_H
+
+// Per-layer weight scales: real weight = q * SCALE, SCALE ~= MULT / 2^SHIFT
+#define Q_CONV1_SCALE 0.0134597953f
+#define Q_CONV1_MULT 28227
+#define Q_CONV1_SHIFT 21
+#define Q_FC1_SCALE 0.0353842874f
+#define Q_FC1_MULT 18552
+#define Q_FC1_SHIFT 19
+
+const QuantizedConvNet convnet_quantized = {
+    .conv1 = {
+        .weights = {
+            {15, 48, 77, 82, 17, -81, -127, -58, -28},
+            {-45, -22, -65, -9, -36, -42, -64, -10, 78},
+            {-116, -71, -42, 83, -42, -81, 54, 83, 4}
+        },
+        .biases = {-15224, -30752, -30456}
+    },
+    .fc1 = {
+        .weights = {
+            {3, 4, 3, 3, 3, 2, 2, 3, 1, 2, 3, 3, 3, 3, 12, 13, -34, 10, 46, -5, -16, -20, 29, 23, -36, 40, 22, 28, 11, -17, -44, 9, -30, 9, -9, -10, -6, -18, -12, -15, 5, -2, 10, -35, 0, -39, -18, -5, -17, 7, -7, -3, -4, -18, 0, 33, 54, -43, -34, -6, 5, -2, 2, -8, -1, -14, -14, -5, 8, -30, 34, 22, 5, -34, 14, -8, -9, -2, -5, -10, -11, -16, -10, -52, 10, 1, -36, 6, 9, -2, -15, -2, -6, -13, 5, -2, -17, -51, 12, -13, -20, 7, 5, -15, -3, -18, -16, 6, 8, -4, -4, 0, 12, -16, 20, 3, 7, -21, 1, -26, -13, 6, 5, -3, 11, -18, -5, 13, -19, -14, 7, 2, -11, 5, 0, 11, 2, 8, -2, 25, 21, 0, -2, -17, -12, -7, 6, 3, -10, 7, 6, 9, -1, -33, -38, -30, -10, -14, -7, 5, 9, 0, -2, 3, 7, 40, -4, 18, 12, -49, 10, -3, -13, -13, 8, -5, -1, 2, -7, 6, -52, 10, 12, 10, -66, -15, -11, -21, -40, -21, -56, -58, -54, -7, 10, 9, 2, 0, 1, 1, 0, 1, 0, 0, 0, 2, 0, 2, 1, 1, 3, 1, 2, 2, -5, 3, 1, 6, -1, -5, 1, 3, 0, 2, 2, 1, 3, 3, 5, 3, 2, 13, -9, -5, -3, -3, 3, 1, 1, 2, 4, 4, 2, 8, -6, 7, 19, -5, -3, -5, -4, 2, 2, 2, 9, 1, -12, -4, 3, -5, -12, -24, -27, -7, 8, 3, 1, 1, 0, -2, 15, 16, -9, -18, -20, 11, -19, 5, 0, 4, 1, -2, 7, 3, 14, 2, 2, 18, 0, -11, -1, -12, -7, 2, 1, 1, 8, -20, -11, -15, 2, 17, 15, 9, -8, -7, -1, 3, 2, 9, -3, -27, -26, -7, 8, 19, 12, 14, 0, -5, 4, 4, 2, 4, -14, -32, -50, -13, 23, 14, 21, 9, -3, -6, 3, 2, 0, -3, -7, -19, -29, -34, -12, 17, 6, 12, 6, 1, 6, 2, 1, 3, 4, -31, -14, -12, -11, -1, 4, -4, -1, 2, 7, 2, 3, 1, -3, -1, 3, 6, 2, 10, 4, 6, 2, 1, 1, 2, 2, 2, 1, 3, 3, 2, 4, 5, 4, 2, 2, 1, 1, 2, 3, 9, 10, 9, 3, -1, -14, -41, -30, -5, 0, 6, 7, 8, 5, 6, -18, 11, 3, -10, -8, 0, -1, 0, -1, 9, 2, 7, 2, 3, 8, 0, -3, 10, -9, 7, 1, 8, 4, 8, -6, -10, 9, 7, -28, -28, 6, -10, -10, 12, 3, 4, 1, 15, 8, 16, 3, 19, -7, 9, -8, 13, 0, -14, 0, 14, 8, 0, 16, -26, 4, 13, -31, -19, -5, -6, -16, -8, -5, -2, -4, 1, 23, -25, 3, -4, 21, -10, -6, -9, -7, -11, -13, -1, -8, 1, -7, 5, 2, 15, -10, -25, -26, -16, -2, 11, 2, -20, -3, -10, -5, -7, 3, -2, -23, -29, -2, -11, 2, 0, 1, -17, -1, -40, -22, 10, 4, -13, -16, -11, -9, -2, 3, 15, -9, -7, -32, -14, -37, -9, 2, -6, -42, -21, 3, -2, 9, 11, 0, -23, -21, -34, -12, 11, 4, 14, -25, 0, 23, 4, 28, -13, 0, -14, -32, -3, -17, 10, 4, 11, 13, 10, 21, 26, 7, 16, -1, 10, 22, 8, 9, 10, 1, 2, 2, 2, 3, 4, 3, 3, 3, 4, 2, 2, 4, 2},
+            {3, 3, 4, 3, 4, 4, 4, 3, 5, 4, 2, 4, 3, 4, 21, 23, -10, 16, 10, 13, -33, -108, -87, -63, 28, -13, 21, 18, 26, 11, -29, -52, -26, -45, -35, 23, -22, -21, 17, 1, -23, 13, 21, 13, 8, -9, -5, -28, -10, -20, -33, -7, -12, -5, -28, -39, 18, -30, 3, -35, 3, -4, -10, -7, -25, -2, 5, -5, -26, -39, 21, -67, 14, -1, 11, -12, -1, -6, -24, 2, -2, 21, 17, -7, 24, 34, -32, -6, -4, -9, 0, -23, -12, 1, -17, -6, -34, -26, 20, 16, 15, 30, 11, 3, -25, -8, -6, 1, 5, 5, 14, -38, 19, -7, -24, 16, 4, 0, -24, -6, -1, -35, -4, 13, -12, -13, 19, -40, -20, 31, -8, -15, -8, -15, -20, -18, 17, -14, -17, 40, 19, -17, 5, -1, -1, 2, -8, -10, -3, 4, 0, 10, -3, -22, -27, 16, -2, 6, 1, -14, -7, -8, -12, 4, -11, -2, -4, 21, 18, 8, 1, -2, -4, 8, -2, 0, -12, 10, -3, -24, -24, 29, 20, 5, -18, 29, -11, 0, 2, -12, -25, -101, -34, -6, 20, 20, 1, 0, 0, 1, 0, -2, 6, 3, 3, 4, 0, -1, 0, 0, 0, 1, 1, -1, 5, 2, 5, 8, 9, 3, -1, -1, -1, -1, 0, -1, 0, -8, -4, -1, 6, -2, 1, -2, 8, 0, -1, 1, -1, 3, -4, -10, -1, -24, -3, -9, 10, 3, -1, 2, 3, 0, -1, -1, -2, 2, 9, -1, 3, 13, 9, 11, 4, 0, -1, 1, 0, 0, 1, -6, 19, 2, 24, 1, -2, 5, -2, 1, 0, 0, 0, -1, -1, 9, 13, 10, -7, -3, 14, 11, 1, 4, 1, 0, 0, -1, -1, 8, 9, 18, -4, -26, 5, 10, 2, 1, 0, 0, 1, 0, -2, 9, 10, 2, 8, 7, -11, -3, 0, 3, 1, 1, 1, 0, 3, 19, 1, 3, 2, -1, -5, -2, 0, -1, -2, -1, 0, 3, 5, 6, 0, -9, 5, 4, -14, -14, 0, -3, 1, 0, 0, -1, -9, 6, -1, -1, 7, 0, 9, 3, 2, 4, -1, 0, 1, -1, 6, 1, -6, 6, 18, 5, 7, 2, 1, 1, -1, 0, 1, 0, 0, -1, 1, 2, 3, -2, 1, 1, 0, 1, 1, -1, 2, 1, 0, -2, -14, -23, 12, 28, -4, 10, 35, -3, -3, -1, 2, 1, 23, -18, -3, 20, -3, 1, -3, 2, 2, -1, 13, -5, 3, 0, -1, 22, 7, -2, -9, 3, -7, -12, -3, 3, 6, -19, 4, 2, 5, 10, 14, -7, 5, -10, -15, -8, -2, -16, -13, -15, 2, -6, -18, 7, 12, -8, -6, -24, -15, -20, 1, -27, -15, -6, 2, -1, 4, -23, -8, 2, -21, -13, 4, -23, -2, -24, -25, -8, 3, -1, -6, -46, -14, 0, -46, -14, -8, -18, -21, -13, 16, -14, 2, 3, 6, -9, 10, -12, -40, -5, -23, -19, 4, -16, -5, 3, 2, -7, -27, -15, 8, -4, -42, 0, -14, 0, -9, -2, 4, 15, 4, 5, -18, 3, -1, 10, -4, -11, -4, 6, 12, -3, 6, 8, 2, 15, 18, 23, 7, 7, -8, -4, 2, 14, 3, 18, 17, -13, 4, -2, -35, -39, 12, -22, -37, -2, 26, 5, -3, 27, -5, 1, 2, -2, 1, -9, -8, 8, 36, 31, 17, -23, 2, 2, -3, -1, 4, 3, 4, 3, 3, 3, 4, 1, 1, 2, 3, 3, 2, 2},
+            {-1, -1, -1, -2, -2, -2, -2, -2, -4, -1, -1, -2, -2, -2, -20, -25, -28, -4, -4, -21, 17, 55, 8, -15, -80, -6, -4, -21, -21, -50, -9, 31, -4, 7, -3, 1, -2, 12, -17, -50, -24, -27, -18, 14, -1, 3, 4, 2, 2, 3, -2, 2, -26, -10, -12, -16, 0, -18, 20, 6, 3, 2, 1, -3, -1, 1, -5, -10, -7, -55, -31, 5, 18, 10, 2, 5, 3, -3, 3, -6, -8, 12, -37, -3, -28, -21, 16, 2, 7, 4, 6, -14, -4, -5, 1, 2, 14, -21, -24, -6, -10, 6, -12, 4, 0, -15, 3, 9, 2, 10, 17, 3, -32, 6, -23, 6, 0, 3, 3, 1, 4, 0, 1, 15, 9, 21, -15, 24, 0, 6, -1, 11, 12, 3, 7, -3, 8, -1, 11, -5, -17, 8, 11, 0, -1, 10, 2, 11, 8, 0, 1, 4, 13, 27, 44, 32, -2, 2, 6, 4, -2, 0, 0, 4, -1, -17, 20, -2, 6, 5, 5, 10, 1, 0, 6, -1, -4, -8, -6, -16, -3, 7, -20, -34, -16, 0, -16, -10, -11, 5, -15, -23, -5, -22, -30, -20, 0, -1, 0, 0, 0, 1, -2, -5, -2, -3, 1, 1, 0, 0, 0, -1, 0, 0, 1, -5, -3, -1, -12, -8, 6, -2, 0, -1, 0, 1, -1, 0, -2, -1, -15, -13, -14, -6, -5, -8, -1, -2, 1, -2, 1, 4, -3, 0, -2, -12, -16, -16, -3, -10, 1, 0, -1, -5, 3, 15, 2, -2, -15, 5, 3, -2, 4, -4, 4, -2, -2, -5, -4, 2, 4, 7, 8, 11, -1, -6, 3, 3, 1, 0, 0, 0, 11, 32, 20, 21, 19, 12, -9, 8, 6, 11, -4, 0, 1, -1, 14, 10, 32, 30, 5, 26, 7, 3, -1, 14, -1, -1, 0, -1, 3, 6, 11, 9, 10, 16, 12, 0, -6, -3, -1, -1, -2, -8, -14, -7, -14, -13, -2, 14, -8, -8, -1, 1, -1, 1, 0, 0, -5, -19, -20, -21, -19, 2, 2, -12, 5, 6, -3, -2, -1, -6, -5, 5, -31, -29, -11, -10, 3, -4, 6, 9, -4, -1, 0, 3, 8, 0, -7, -15, -3, -1, 0, 2, 8, 4, -1, 0, -2, 0, -1, -1, 1, 3, 0, 1, 5, 3, 0, 0, -1, -1, -4, -15, -16, -14, 10, 25, 10, -15, 3, -11, -36, 2, 13, -7, -2, -18, -14, 15, -4, 7, 3, -8, -1, 0, -16, 7, -16, -12, -3, -1, 2, -3, 0, 1, -4, -1, 2, 1, -1, 6, -11, -30, -2, -4, 4, -6, -14, 9, -11, 3, 9, -6, -3, -11, -38, -17, -4, 20, -18, 11, -15, -2, -4, 8, 2, 2, -3, -14, -2, -16, -2, -33, 5, 13, 14, 1, 12, -2, 0, -5, -14, -15, -13, 5, -3, -7, 17, 14, 25, 13, 4, 6, 4, -12, -23, -6, -18, 10, -3, 6, 13, 12, 7, -9, 0, 3, 5, -12, -10, -2, 6, 7, -4, 0, 4, -2, -7, -12, -10, 1, -4, -11, 1, 10, 2, 27, -4, 5, -12, -13, -22, -4, -11, -4, 8, 7, 7, 12, -4, -5, -4, -16, -20, -34, 1, -13, -10, 1, 5, 14, 22, 27, 12, -10, -2, -29, -6, -14, -8, -7, -1, 0, 14, 25, 15, 8, 10, 3, -4, -11, 1, -18, 0, 21, 14, 5, 27, 33, 35, 9, -22, -12, -2, -1, -1, -1, 0, 3, 0, 0, 4, 3, -1, -1, -1, -2},
+            {-3, -4, -2, -3, -3, -4, -4, -2, -2, -2, -4, -4, -3, -2, -4, -4, -10, -10, 7, 21, -13, -27, -19, -57, -7, -23, -7, -2, 3, 32, 17, 7, 8, 2, 14, -1, 12, -5, -12, -31, -77, -5, -4, 2, -2, 15, -1, 4, -2, -1, -5, -4, -7, -14, -24, -43, -26, 0, 25, 13, 3, 5, 4, 6, 6, 3, -11, -17, -5, -65, 22, 20, 5, 14, 8, 7, 9, 4, 14, 10, 6, -2, -26, -9, -14, -12, -1, 12, 5, 4, 8, 10, 13, 15, 6, 10, -5, -17, -22, -5, 4, -8, 7, -3, 0, 11, 5, 5, -6, -15, -19, -11, 12, -42, -40, -25, -11, -4, 5, 2, 7, 2, -11, -35, 9, -15, 15, -43, 13, -8, -16, -1, 7, 1, 14, -5, -8, -9, -34, -36, 25, 1, 2, 1, -4, -15, -6, 8, 8, 3, -5, -9, -5, -36, -26, -9, -3, 6, 9, 4, 6, 1, 8, -3, 9, -14, 4, -9, -10, 9, -12, -1, 11, 3, 5, 7, 10, 5, 7, 19, 15, -1, -4, -2, -4, 12, -16, 1, 4, -8, 15, 18, 27, 6, -21, -3, 0, 0, 0, 0, -1, -1, -1, -1, -1, -3, 0, -1, 0, -1, -2, 0, 0, 1, -5, 1, -8, -8, -15, -12, -13, -1, -1, 0, 0, 0, -2, -2, 5, -1, -10, -22, -19, -14, -16, -4, 0, -1, -2, -1, -8, 1, 1, 2, -11, -13, -15, -16, 5, -5, -6, 0, 0, 1, 3, 10, 10, 19, 8, 2, 3, 7, -1, -4, 1, 0, -1, -4, 6, 19, 22, 26, 15, -1, -12, -3, 3, -1, 3, -1, -1, -5, 7, 19, 19, 21, 7, -8, -10, -30, -10, -3, 2, 0, -1, -1, 2, 4, -12, 1, -12, -22, -29, 9, 3, -2, 0, 0, -2, -3, -2, -1, -7, -3, -16, -10, -19, -9, -2, -4, -1, 0, 0, -1, -2, 9, 22, 8, -4, -4, -4, -7, 8, -1, 0, 0, -2, 0, -1, 14, 11, 18, 9, 8, 4, -1, -1, 4, 2, -2, -1, 3, 2, 12, 24, 24, 23, 2, 12, 3, -1, -3, 2, -1, -2, -5, -5, -9, -4, -6, -6, -2, -9, -14, -8, -4, 0, 0, -1, -2, -2, -3, -2, -8, -7, -1, -6, -5, -2, -1, 0, -1, -3, -7, -5, -6, -6, -3, -4, -8, 3, 6, -18, -9, -6, -5, -3, -1, 6, -9, -5, -1, -3, -1, 3, 5, 8, 5, -15, -5, -3, -5, -2, -8, 2, 3, 12, 1, 11, -4, 2, 0, 22, -11, -3, -1, -22, 2, 4, 16, 8, 7, -1, -5, -1, -12, -4, -18, -1, 6, 12, 8, 0, 7, -2, -2, 3, -8, -13, -8, -7, -9, -3, 9, 30, 14, -8, 2, -6, 2, -3, -6, -9, -17, -18, -4, -3, -3, 31, 7, -5, -5, -14, 6, -1, -1, 6, 5, 4, -7, -2, 11, 26, 3, 10, 2, -3, 4, -2, 10, 5, 4, 3, -8, -3, 13, 12, 21, 16, 22, 2, -3, 8, 5, -4, 3, 0, -13, -3, 8, 15, 22, 20, 11, 5, 18, 6, -8, -1, -16, 6, -12, -3, -7, 32, 13, 5, 9, 0, -4, -1, -3, -6, -34, 3, -8, -2, 3, -1, 19, 6, 6, -8, -3, -7, -11, -23, -37, 8, -4, -2, -12, -13, 25, 31, 5, 1, -17, -61, -19, -41, -32, -7, -4, -2, -2, -3, -6, -4, -11, -10, -4, -7, -9, -5, -3, -2, -3},
+            {0, 1, -1, -1, 0, 0, 1, 0, 0, 1, 1, 1, 0, -1, 2, 4, 1, 1, -3, -7, 16, -13, 38, 9, -5, -17, -32, 0, 1, 2, -13, 26, -36, -46, -25, -22, 9, -20, -4, 1, 13, 2, 1, 4, -21, 7, -14, -16, -17, -16, -7, -23, 6, 15, -6, -30, -9, 41, -24, -16, -2, -11, -11, -7, -13, -20, 3, 11, 0, 13, -39, -15, -28, -28, -5, -1, -3, 0, -18, -8, -5, -7, -1, -36, 23, 6, -18, -12, -1, 3, 0, -15, -22, 4, 1, 1, -3, -29, 12, -28, -2, 2, 4, 10, -2, 0, 1, 13, 4, 1, 0, 14, 30, 27, 8, 7, 11, -2, 0, 8, 6, 9, 2, 2, -4, -3, 1, 14, 6, 0, 8, -5, -6, -3, -3, 13, -7, 14, 1, -27, 6, 11, -23, 8, 12, -2, 1, 0, -9, -2, -7, 0, -14, 6, -11, 16, 4, 6, -18, -9, -5, -16, -5, -1, 1, 1, -15, -50, 2, -53, -39, -6, 3, -1, -9, -3, -17, -3, 0, 2, -2, -21, 0, -2, 18, -38, 6, -4, -6, -5, -8, -5, -39, 3, -30, -1, -2, -1, -1, -1, -2, 0, 3, -3, -2, -2, -1, -1, -3, -1, -1, -2, -4, -3, 1, -2, 5, 0, 1, 6, -1, 1, 1, -1, -2, -4, 1, 5, -2, 6, 8, 22, 21, 23, 10, 12, -3, -1, -2, -1, -3, -7, 7, 13, 6, 24, 27, 24, 11, 15, 2, -2, -1, -3, -5, -5, 2, 15, 16, 17, 11, 24, 10, 6, -4, -3, -1, 1, 7, 10, -6, -8, 8, 9, -8, -1, 8, -2, -3, -2, -2, 0, -7, -2, -6, -13, -22, -7, -6, -1, -16, -12, 5, -1, -2, 0, -13, -9, -14, -24, -9, 2, -26, -4, 9, -2, 8, -1, -2, -1, 2, -6, -4, -2, 3, -7, 4, -9, 12, 6, 5, 0, 0, 5, 0, -7, -8, -8, 2, -7, -9, -10, -11, 4, 0, 0, -3, -8, 5, 14, 8, 8, 9, 6, -12, -13, -4, -4, -2, -1, -3, -1, 1, 3, 5, 8, 2, -7, -15, 9, -1, -2, 0, -1, -1, -2, -3, -4, -4, 7, 8, 1, -3, -5, -5, -3, 0, -2, -2, -1, 0, 1, 0, 4, 0, 4, 5, 4, 1, -2, -1, -1, 1, 7, 5, -6, -27, -25, -11, 2, -29, -40, -16, -15, -4, 6, 1, 8, -10, -17, -1, 8, 16, 8, 13, 9, 14, 15, 5, 10, 2, 1, 4, -3, 14, 18, 4, 12, -2, 6, -2, -4, 1, -2, 1, 22, 26, 11, 12, 6, 0, -10, -10, -3, -12, 5, -10, 0, 0, -18, 20, 0, 10, -6, -16, -15, -16, -8, -12, -5, -27, -13, 0, 6, 3, 3, -4, -5, -2, -13, -17, -14, -4, 0, -22, -19, 1, 4, -14, -19, -15, 0, -1, 4, -16, -5, -1, -8, 0, -9, 2, 2, -22, -22, -5, 2, 14, -1, -7, -1, -1, 3, -8, -2, 1, 3, -17, -24, -5, 3, 3, 16, -12, -6, 1, -4, 5, -35, 1, -2, -1, 1, -7, -2, 4, -13, -5, -1, -10, 11, -5, -1, 1, -3, -2, -20, -9, 1, 6, -48, -15, 3, -13, 15, -10, -5, 2, 7, 4, -14, -14, -43, -16, 6, 6, 3, 13, -1, 18, -2, 1, 7, -1, 8, -13, 17, -14, 1, 13, 5, -13, 41, 13, 8, -1, -1, 1, 1, 4, 3, 4, 7, 9, 5, 4, -1, 1, -1},
+            {-3, -3, -1, -1, -3, -2, -1, -2, -2, -2, -1, -3, -1, -1, -16, -19, 37, -18, -18, -22, -19, 3, -30, 18, 42, -55, -7, -29, -21, 14, 33, -59, -1, -11, 11, 9, 6, 11, 7, 21, -2, 2, -12, 6, -9, -23, -17, -7, -1, 3, 13, 17, 16, 9, 9, 0, -7, -82, -21, -16, -2, -12, -4, -4, 8, 4, 17, 11, 5, 18, -20, -35, 5, -23, -13, -4, -6, -8, -3, -1, -1, 13, 37, 6, -16, -13, -15, -10, 0, -6, -5, -1, -3, -7, -14, -13, 19, 25, -14, -21, 14, 3, 5, -3, 2, 3, -6, -29, -20, -12, -8, 13, -16, -9, 12, -16, -4, 8, 0, -2, -9, -17, -8, -28, 4, -21, -24, -6, 6, 4, -14, 4, 3, 4, 0, -15, -14, -10, -1, -60, -30, -32, 13, 11, 1, -10, -6, -7, 4, -2, 0, -12, -19, -4, -14, -40, -5, -2, 6, 10, 0, 3, 3, 3, -2, 0, 7, 30, -18, 8, -9, -3, 0, 8, 4, 7, 7, 8, 8, -3, 30, 6, -16, -29, 9, 0, -6, 0, 8, -5, 17, 15, -5, 34, 55, -18, -1, -1, -2, -2, -1, -1, -1, 0, -2, -2, -3, -2, -2, -1, -2, 0, -2, -2, -5, -10, -6, 3, 9, 2, -3, -4, 0, -2, -1, -1, 0, -2, 1, -5, -7, -5, 2, 2, 6, 5, 0, -1, -1, -3, 0, -12, -17, -6, -8, -10, -3, 0, 0, -4, -3, -4, -1, -1, -5, -3, -8, -4, -12, -3, -19, -13, -14, -8, -8, -1, -1, -2, 3, -10, -17, -4, -17, -9, -10, -6, -9, 1, -12, -3, -2, -5, -2, -8, -9, -20, 0, 7, 13, 19, 19, 16, -3, -3, -1, -7, 0, -3, -16, -26, -1, 14, 16, 0, 13, 8, -2, -1, -2, 5, 28, 13, -4, -12, -9, 7, 12, 19, 11, 4, -5, 0, 0, -1, 19, 15, 21, 8, -3, 8, 8, 10, 10, -1, -1, -3, 0, 2, 4, 19, 18, 13, 2, 0, 16, 11, 1, -3, -1, -4, -1, 0, 5, 1, 2, 1, 7, 13, 6, 7, -1, -1, -4, -3, -2, -1, 2, 0, 0, -1, -9, -2, 4, -9, -2, -2, -1, 0, -1, -2, -1, 2, 3, -3, -1, -2, -6, -1, -1, -2, -1, -2, -4, -10, -11, -10, -11, -14, -19, -19, 3, 19, 2, -15, -12, -9, -4, -8, 4, -17, -2, -6, -10, -1, 3, -9, 3, -14, -16, 9, -5, -16, -18, 5, -14, -1, 3, -1, -6, -5, -7, -15, -3, 12, -3, -20, -8, -11, -4, 0, 7, -2, -7, -2, 1, -2, 0, 11, -4, -29, 10, -7, 1, -2, 3, 4, 7, 8, 6, -5, 10, 15, -5, -7, -27, -10, 1, 8, 8, 15, 15, 17, 17, 9, 7, 3, -5, -15, -49, 20, 0, -2, 4, 21, 19, 14, 16, 20, 20, 12, -4, -31, 20, 24, -1, 11, 0, 11, 14, 11, 12, 9, 12, -10, -4, 2, 30, 20, 15, 11, 9, 4, 13, 6, 6, 7, 7, -6, -4, -11, 30, 9, 10, 10, 8, 5, 4, -1, -2, -8, -4, 26, -5, 22, 19, 16, 3, 1, -1, 1, -2, 9, -3, -12, 4, 3, -4, -2, 22, 14, 4, 5, 1, -5, 2, -26, -19, -11, -34, -17, -5, -8, -10, 3, -26, 26, 12, 10, -23, -25, -32, -26, -2, -9, -3, -2, -2, 0, 3, -2, -1, -2, -7, -2, -2, -3, -4, -2},
+            {0, 0, 1, 1, 2, 1, -3, 2, 1, 0, 1, 1, 1, 2, 0, 0, -16, 1, -43, 7, -22, 39, -11, 48, 7, 42, 15, 6, -6, -20, 0, -58, -27, -8, -5, -20, -14, -2, -3, 2, 9, -23, -1, -43, -12, -31, 15, -4, 5, 3, 3, 7, 16, -9, 10, 4, -2, -36, -26, -12, -22, 16, -13, 3, 7, 5, 3, 15, 19, -1, -4, 36, -70, -26, -4, -9, 1, -7, -9, 5, -2, -21, -41, 4, -2, -6, -4, 23, -14, -16, -13, 11, 3, -7, -11, 3, 5, 3, 0, -37, -1, 6, -12, -28, 1, 12, -5, 1, 7, 2, -6, -30, -1, -14, 0, 0, -12, -17, -8, 8, -7, 8, 2, 7, -6, -2, -1, 3, -15, 2, -4, -16, -12, -7, 11, 9, 1, -4, 22, 18, -1, 12, 12, -18, -4, 7, -5, 3, 10, 9, 2, 5, 11, 18, 0, -14, -25, 4, -5, 0, 6, 3, 11, 2, 10, 14, -24, -2, -1, -4, -47, -42, -4, 5, -6, -5, 11, -6, -2, -18, -77, -2, -1, -3, -3, -7, -26, -10, -13, -30, -12, -8, -6, -4, -1, 1, 1, 1, 2, 2, 0, 1, -6, 6, -3, 3, 1, 1, 1, 2, 2, 0, 4, 1, 7, 0, -2, -6, -5, 5, 2, 5, -5, 2, 0, 2, -2, -1, -8, 4, 7, 10, -4, -1, -2, -3, -3, 1, 1, 1, -1, 1, -4, 10, 8, 16, 19, 21, 4, 5, -4, 1, 2, 1, 1, -5, -2, 1, 22, 5, 6, 4, 0, 14, 2, 1, 2, 0, 4, -7, -9, -4, 21, 10, 21, 18, 16, 4, 2, 3, 1, 1, 6, -12, -21, -1, -2, 24, 10, 5, 4, -7, -1, 0, 2, 2, 3, -21, -41, -14, 16, 15, 21, 4, 10, -11, 5, 0, 2, 1, -6, -8, -37, -32, 6, -11, -2, 1, 1, 1, 4, 1, 1, 1, -7, -19, -21, -37, -30, -8, -1, 5, -7, -4, 6, -1, 1, 2, 4, -25, -28, -17, -22, -31, 8, 5, 9, -3, 4, 1, 0, 0, 3, 4, -2, -15, -11, 5, -17, 1, 5, 3, 4, 0, 1, 2, 1, 3, 7, 11, 6, -8, -9, 1, 3, 3, 1, 0, 2, 0, 1, 0, 2, 1, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 0, 16, 24, 5, -2, 9, 29, 3, 29, 29, 1, -3, 1, -1, 12, 13, 38, 8, -7, -5, -6, -7, -1, -4, 10, -6, 2, 3, 17, 21, -14, -15, -28, -16, -8, -13, 2, -4, -5, 3, 1, -2, 15, -30, -9, -34, -22, -26, -28, -10, -1, 2, -34, -10, 0, -5, 8, -26, -13, -34, -15, -14, 11, 3, 12, 14, 2, -9, 1, -18, -20, -51, -13, -23, -21, 1, 24, 14, 12, 1, 12, 12, 2, -6, -19, -13, -33, -35, -11, 18, 23, 6, 9, 9, 18, 7, 0, -3, -54, -11, -11, -32, -7, 10, 11, 8, 19, -4, -24, 6, 0, 0, -37, -7, -20, -17, -4, 2, 18, 18, -8, -17, 9, -1, 1, -5, -7, -39, -11, -2, -3, 1, 1, 0, -8, 9, -19, 0, 1, -3, -5, -49, -14, -5, 14, 7, 7, -1, -9, -17, 9, 3, 0, 1, 2, -15, -22, 21, 1, 10, -14, -11, 9, 16, -15, -1, 1, 0, -1, 2, 7, 13, 24, -7, 24, -5, 3, 1, -14, 0, 2, 2, 1, 3, 2, 1, 2, 2, 1, 2, 1, 1, 2, 1},
+            {1, 1, 2, 3, 3, 1, 2, 2, 2, 2, 2, 1, 1, 1, -6, -7, -7, -10, -9, -9, -9, -21, -19, -9, -11, -9, -9, -7, -7, -11, -17, -32, -50, -65, -5, 27, -28, -33, -48, -40, -25, -8, -6, -24, 15, 4, 4, 6, 8, -5, -10, -11, -24, 24, -57, -54, 18, 19, -20, -2, -6, 2, 2, 0, -8, -2, -5, -8, 5, -63, 8, -16, -13, 8, -2, -4, 0, 8, 4, -4, 1, -2, -6, 5, 37, 27, 2, 2, 2, 7, -1, -3, 4, -2, 2, 3, -17, 27, 8, 24, 4, -4, 5, 21, -22, -19, 2, 1, 2, -10, -1, -15, -10, 8, 5, 7, 17, 2, -17, -12, -6, 19, 7, 8, -17, -38, -4, 6, 10, -10, 8, 7, -13, -1, -19, 9, 12, 10, -15, 12, 23, -4, -12, -2, 3, -7, 0, -15, -19, -4, 8, -8, -10, -23, -8, 25, -7, -6, 6, -7, -6, -12, -11, -7, 0, -12, -21, 32, -11, -3, 15, 1, 2, -6, -9, -16, -9, -6, -7, -15, -57, -2, -7, 39, 17, 6, 5, 8, -2, 5, 5, -7, 8, -19, -20, -7, 1, 1, 1, 2, 0, 1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, -1, 0, -1, 2, -2, 0, 0, 1, 1, 0, 0, 1, 1, -2, 1, -5, -3, -5, -4, -16, 0, -6, 10, 2, 0, 1, 0, -1, -7, -11, -8, -11, -7, -22, -11, -5, -3, 4, 0, 0, -1, 2, -16, -11, -10, -12, -5, -10, -2, -7, 16, -5, 5, 2, 1, -4, -11, 4, 11, -1, 3, 6, 4, -3, -1, -1, -1, -1, -1, 1, 9, -2, 4, 13, 15, -1, -6, -17, -10, -5, -1, -1, 1, 4, 7, 28, 36, 20, 16, 4, -12, -17, -13, -4, 0, 1, 1, 0, -7, 15, 16, 17, 23, 1, 13, 3, -2, 1, 0, -1, 0, 0, 3, 11, -3, 13, 20, 5, -4, -4, -9, 2, 3, -1, 0, 1, -5, 5, 10, 2, 11, -14, -6, -2, -6, 3, 1, 1, 0, 1, -2, 1, 6, 6, -3, -6, -9, -5, 3, 0, 1, 0, 1, 1, -3, 6, 6, 0, -6, -7, 8, 8, 3, -3, -1, 0, 1, 2, 2, 2, -5, -2, 0, -5, 2, -1, 5, 0, 1, 2, 2, 8, 8, 10, 8, 8, 5, 3, 4, 7, 9, 10, 8, 9, 3, 10, 5, -1, -27, -16, -2, -11, -28, -33, -11, 2, 8, 8, 2, 11, 4, -1, -1, 2, 0, 1, -3, 7, -1, 6, -23, 4, 5, 0, 12, 4, 14, 15, 10, -2, 4, 8, 4, 0, 11, -11, 4, 6, 21, -3, 23, 14, 7, 2, -2, -5, -1, 4, -2, -10, 5, 16, 12, 24, 14, -1, -11, -5, -20, -3, -6, -7, -18, -4, 3, 39, 30, 3, -1, -6, 7, -24, -20, -1, -1, -7, -2, 1, 2, 16, -16, -13, 0, -3, -2, -14, -5, 1, -3, -10, 0, -5, 2, 19, -16, -22, -2, 2, 2, -13, -3, 5, -5, -12, -5, 9, 2, 15, -28, -11, -6, -17, 1, -27, -23, -1, 0, -5, 15, -29, 3, 9, -21, -8, -8, -20, -4, -12, 0, -14, -17, -17, -33, 6, 3, 15, 7, -18, -46, -43, 2, -5, -3, -23, 1, -1, -24, 9, 4, 14, 8, -36, -36, -62, -14, -3, -15, 0, 10, -8, 7, 8, 3, 2, 3, 4, -2, -4, 5, -1, 1, 1, 6, 2, 3, 2},
+            {-2, 0, -1, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, 0, 0, -14, -16, -4, 0, -17, -24, -33, -13, -18, -4, -2, -6, -7, -109, 16, 14, 0, 1, 4, 0, 11, 7, -5, 26, -5, -45, -18, 11, 5, 2, 6, 7, 2, 0, -2, -4, 11, 13, -8, 26, -8, 3, 3, 1, -3, 4, 3, 9, 4, -10, -4, 6, -19, 28, -10, 2, -13, 5, -1, -2, 6, 4, 12, 2, -12, -6, -36, -21, 14, -7, -10, -2, -4, -2, 9, 9, 12, 1, -6, -3, -20, -8, -8, -4, -9, -3, 4, 5, 6, 5, 6, 11, 3, -15, -2, -48, 11, -13, -2, 0, 1, 6, -3, -7, -5, -7, -8, 9, -3, -4, 3, -6, 4, -2, 4, 0, -4, -13, -7, -18, 15, 9, -7, 3, -10, -5, -3, -2, 5, 3, 6, -9, 0, -5, -2, -28, -4, -12, 9, 2, -9, 0, 3, 7, -1, -3, -8, 9, -19, -29, -2, 9, -4, 4, -10, -4, 6, 8, 9, 9, 5, 19, 2, -8, 0, -65, -11, -22, 2, -6, 0, 1, -4, 2, 7, -43, -17, -1, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, -1, 1, 0, 2, 0, -1, 2, 1, 5, 7, 2, 10, 8, 7, 1, 3, 2, 1, 0, -1, 6, -3, 5, 12, 11, 10, 9, 4, -1, 2, 1, 1, 2, 8, 8, 4, -4, 5, 6, -8, 5, 3, 0, 10, 2, 1, 2, 5, 3, 1, -10, -16, -5, 2, 0, 2, 4, -5, -3, 0, 2, -7, -11, -16, -15, -17, -14, 3, 0, 6, 0, 2, 1, 0, 1, -2, -20, -15, -13, -11, -12, -2, 5, 5, -7, 0, 0, 1, 1, 0, 5, 4, -9, -6, -12, 5, -15, -11, -1, -7, 0, 0, -1, -1, 3, 12, 3, -8, -10, -11, -12, -8, 3, -5, -1, 1, 0, 1, -3, 1, 4, -12, -5, 14, 8, 8, 4, -3, 1, 0, -2, -4, -18, -30, -15, -16, 1, 5, 12, -1, 0, 2, 2, 1, 0, -5, -18, -24, -24, -18, 3, 9, 2, 1, -4, 0, 2, 1, 1, -3, 3, -7, 3, -7, 2, 4, 8, -1, 2, 2, 2, 0, 1, 0, 0, 2, 2, -2, 0, 0, 2, 1, 1, 0, 0, 0, 5, 5, 5, 4, 0, -3, -1, -2, -3, 1, -2, -9, 4, -1, 4, -9, 12, 0, -12, 6, 7, 2, 7, -7, -6, 8, -7, 0, 2, 4, 1, -5, -5, 3, 0, 3, 7, 0, 7, -6, 4, 0, 8, -11, 1, -18, -9, 0, 4, 4, 1, 6, 0, 11, -2, 0, 9, -33, -1, -4, 8, 5, 12, -4, 7, 1, 3, 4, 17, -1, -4, -10, -7, 0, 6, 12, 10, -2, -6, -3, -1, -1, 9, -1, -12, -28, 13, 5, 7, 10, -6, -1, 3, -10, -10, -12, -13, -1, 6, -31, 8, -8, 8, 4, 0, 1, 2, -4, 6, 12, 6, 1, -4, 4, -9, -17, -9, 3, -11, 7, 10, 8, 13, -10, -12, -1, 4, -25, -16, -12, -18, -1, 1, 10, 0, 1, -6, -15, 6, 0, -2, -29, -12, -13, 1, -2, 3, -1, -3, 8, -14, -8, 1, 0, 0, -41, 8, 0, 12, 6, 0, -9, 1, -12, -27, 2, 4, 0, 2, -4, 4, 38, -3, -3, -18, 2, -6, -19, 0, -1, 6, 0, 0, -1, 0, 0, 4, -3, -1, 1, -1, -1, -1, 0, 0},
+            {0, 1, 2, 0, 1, 1, 2, 2, 1, 0, 0, 0, 1, 0, 23, 28, 27, 18, 21, 27, 25, -19, -23, 6, 21, 8, 27, 20, 23, 28, 6, -1, 7, -71, -8, -24, -27, 21, -65, -78, 3, 12, 24, 6, -11, -127, 12, 22, 14, 5, 11, -5, -13, -7, -17, 16, -44, -39, -16, 0, 1, 8, 15, 7, 2, 3, -15, -2, -18, -30, 5, -93, 14, -2, 5, 3, 6, 7, 5, 1, -9, -15, 1, 6, -29, -1, 5, -1, -4, 5, 12, 13, -6, -10, -6, -10, -12, -11, 21, 19, -1, -8, -3, -2, 20, 10, 1, -5, -2, -6, -34, -13, -5, -1, -6, 4, -12, 4, 15, 5, 9, -11, 0, -8, -29, -7, 15, -27, -19, 5, 2, -1, 4, 4, 5, -1, -11, 11, -49, -18, -25, -17, -21, 1, 2, 13, 1, -3, -13, -6, -10, -5, -11, 22, 12, -32, 10, -15, -3, -6, -12, 0, -3, -2, -9, -8, 8, -30, 9, -63, 1, -2, 1, 0, -10, -7, -4, -9, -6, -13, 13, -23, 25, 25, -6, 0, -2, 2, 3, 8, -1, 11, -1, -4, -22, 23, 2, 2, 2, 2, 2, 1, 2, 1, 2, 0, 2, 1, 2, 1, 1, 1, 3, 2, 0, 1, 2, 1, 0, 0, 2, 1, 1, 2, 2, 1, 1, 1, 7, 0, 2, 4, 1, -4, -9, -4, 2, 2, 1, 1, 6, 14, 13, 7, 13, 11, -12, -9, -8, -3, -2, 0, 1, 3, 7, -5, 3, -7, 3, -19, -5, -10, -7, 2, 0, 1, 2, 11, 1, -4, -14, -17, -23, -2, 9, -7, -8, -7, 4, 1, 1, 7, -19, -14, -24, -32, -12, -17, -6, 1, 1, 6, 4, 2, 2, 1, -19, -18, -18, -15, -4, -30, -15, 10, -3, 0, 2, 2, 2, -4, -12, -19, -3, 1, -10, -9, -7, 3, -1, -6, 4, 1, 2, 0, 1, -4, 8, 4, 1, -14, -15, 1, -2, -1, 1, 2, 1, 1, 1, 11, 22, 16, 11, 0, -8, 2, -2, 0, -2, 0, 1, 1, 5, 9, 18, 19, 6, 8, -2, -5, -9, -2, 0, 1, 2, 2, 0, -2, 12, -1, 7, 5, -3, -1, 1, 5, 3, 3, 2, 1, -1, -2, -1, 1, 7, 4, -4, 2, -5, 1, 2, 1, 2, 2, 3, 3, 1, 2, 1, 2, -4, -2, 0, 1, 4, 3, 1, 4, 2, -3, -30, -6, 10, 8, -8, 5, -3, -10, 0, 2, 1, 2, -25, -14, 12, -11, 1, -3, 3, 2, 6, -3, -5, 10, -3, -15, -8, 4, -8, -19, -4, 5, 10, 5, 1, 10, 12, 10, 1, -15, -20, -11, -19, -15, 9, 10, 8, 0, 0, 5, -12, 0, -1, -2, -14, -14, -9, -4, 2, -13, -1, 5, 1, 15, 6, 11, 0, -6, -13, -18, 6, 5, 4, -15, -6, -5, -3, -6, -11, -5, 2, -22, -2, -5, 8, 11, 0, -12, -9, -9, -16, -11, -13, -1, 0, -38, -21, 14, 2, 10, 6, 4, -30, -26, -4, -14, -9, 0, 1, -16, -17, 2, 17, 7, -2, -22, -18, -9, 6, 1, 14, 7, 2, -13, 2, 15, 7, 6, 2, 5, -11, -19, -9, 9, -18, 13, 2, 0, 23, -4, -1, -4, 0, 11, -10, 13, 3, 12, 23, 2, 2, 3, 8, 17, -18, -32, -26, 8, 0, -8, 0, 1, 14, -1, 2, 1, 0, -2, -2, 0, 0, -2, -4, 0, -5, 3, 1, 2}
+        },
+        .biases = {381, 814, -481, -502, -325, -423, 663, 229, -241, 10}
+    }
+};
+
+#endif // CONVNET_QUANTIZED_WEIGHTS_H
@@ -0,0 +1,661 @@
+// Generated by pytorch/prune_weights.py from pytorch/convnet_weights.txt, do not edit.
+#ifndef CONVNET_SPARSE_WEIGHTS_H
+#define CONVNET_SPARSE_WEIGHTS_H
+
+// Fully connected layers pruned to ratio 0.3, in CSR form: the kept weights of output j
+// are values[row_ptr[j] .. row_ptr[j + 1] - 1], at inputs col_idx[...]
+const double convnet_sparse_ratio = 0.3;
+
+// fc1: 4116 of 5880 weights kept
+#define CONVNET_SPARSE_FC1_NNZ 4116
+const int convnet_sparse_fc1_row_ptr[11] = {0, 453, 866, 1270, 1712, 2109, 2548, 2942, 3353, 3724, 4116};
+const uint16_t convnet_sparse_fc1_col_idx[CONVNET_SPARSE_FC1_NNZ] = {
+    0, 1, 2, 3, 4, 7, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 42, 43, 45, 46, 47, 48, 49, 50, 51, 52, 53, 55, 56, 57, 58, 59, 60, 63, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+    74, 75, 76, 78, 79, 80, 81, 82, 83, 84, 86, 87, 88, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    112, 113, 114, 115, 116, 117, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 132, 133, 135, 137, 139, 140, 143, 144, 145, 146, 147, 148, 149, 150,
+    151, 153, 154, 155, 156, 157, 158, 159, 160, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+    188, 189, 190, 191, 192, 193, 194, 195, 210, 214, 215, 217, 219, 221, 224, 226, 227, 228, 229, 231, 232, 233, 234, 235, 236, 240, 241, 242, 243, 244, 245, 246,
+    247, 248, 249, 250, 251, 254, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 270, 271, 272, 273, 274, 275, 276, 277, 279, 281, 282, 283, 284, 287, 289, 291,
+    292, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 319, 320, 321, 323, 324, 325, 326, 327, 328, 329,
+    330, 331, 332, 333, 334, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 348, 351, 352, 353, 354, 355, 356, 358, 359, 362, 364, 366, 368, 369, 371, 372, 373,
+    381, 382, 383, 384, 385, 386, 391, 392, 393, 394, 395, 396, 398, 399, 400, 401, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 417, 419, 420, 421, 422, 424,
+    425, 426, 427, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 445, 446, 447, 448, 449, 450, 451, 452, 453, 455, 457, 458, 460, 461,
+    462, 463, 464, 465, 466, 467, 468, 469, 470, 472, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 486, 488, 489, 491, 492, 493, 494, 495, 497, 499, 500,
+    501, 502, 503, 504, 506, 507, 509, 513, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 533, 534, 535, 536, 538, 539, 541,
+    542, 543, 544, 545, 546, 547, 548, 550, 551, 552, 553, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 569, 570, 571, 572, 573, 577, 578, 579,
+    580, 581, 582, 583, 586, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 74, 75, 77, 78, 81, 82, 83, 84, 85, 86, 87, 88, 89, 91, 92, 94, 95, 96, 97,
+    98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 118, 119, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 146, 147, 148, 149, 151, 152, 153, 154, 155, 157, 159, 160, 161, 162, 163, 164, 166, 167, 168, 169, 172, 173,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 189, 190, 191, 192, 193, 194, 195, 202, 203, 204, 205, 214, 216, 217, 218, 219, 227, 228, 230, 234, 239,
+    240, 241, 243, 244, 245, 246, 247, 250, 256, 258, 259, 260, 261, 262, 269, 270, 272, 274, 275, 283, 284, 285, 286, 287, 288, 289, 291, 297, 298, 299, 300, 301,
+    302, 303, 310, 311, 312, 314, 315, 316, 317, 319, 324, 325, 327, 330, 337, 338, 339, 341, 342, 343, 344, 345, 347, 352, 353, 356, 358, 359, 361, 366, 368, 369,
+    370, 371, 372, 373, 384, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 408, 409, 410, 411, 412, 414, 415, 416, 418, 419, 420, 423, 424, 426, 427, 428, 429,
+    430, 431, 432, 433, 434, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 459, 460, 461, 464, 465,
+    466, 468, 469, 470, 471, 473, 474, 475, 476, 478, 479, 480, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+    502, 503, 505, 506, 507, 508, 509, 510, 512, 514, 516, 517, 518, 519, 520, 521, 523, 524, 525, 526, 527, 528, 529, 530, 531, 533, 534, 535, 536, 537, 538, 539,
+    541, 542, 543, 544, 545, 546, 548, 549, 550, 551, 552, 554, 555, 556, 557, 558, 563, 564, 565, 566, 567, 568, 569, 572, 574, 575, 576, 577, 578, 579, 580, 584,
+    585, 586, 8, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 36, 37, 38, 39, 40, 41, 42,
+    43, 45, 46, 49, 50, 52, 53, 54, 55, 57, 58, 59, 60, 63, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+    85, 86, 88, 89, 90, 91, 92, 93, 96, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 109, 110, 111, 112, 113, 114, 115, 117, 118, 120, 123, 124, 125,
+    126, 127, 129, 131, 132, 133, 134, 135, 136, 138, 139, 140, 141, 142, 145, 146, 147, 148, 151, 152, 153, 154, 155, 158, 159, 163, 165, 166, 168, 169, 170, 171,
+    174, 176, 177, 178, 179, 180, 181, 182, 183, 184, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 203, 205, 215, 216, 218, 219, 220, 230, 231, 232, 233, 234,
+    235, 241, 242, 245, 246, 247, 248, 249, 253, 254, 255, 258, 259, 260, 262, 263, 264, 267, 268, 270, 271, 272, 273, 275, 276, 277, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 296, 297, 298, 299, 300, 301, 302, 303, 305, 310, 311, 312, 313, 314, 315, 316, 318, 319, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+    338, 339, 340, 341, 342, 345, 346, 347, 348, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 365, 366, 368, 369, 370, 374, 375, 383, 386, 387, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 404, 405, 407, 408, 409, 410, 411, 412, 413, 416, 417, 418, 419, 420, 423, 426, 431, 432, 433, 435, 436, 437,
+    438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 454, 455, 458, 459, 461, 463, 464, 465, 466, 468, 471, 472, 473, 474, 475, 476, 477,
+    478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 497, 498, 499, 500, 502, 503, 504, 506, 508, 509, 510, 512, 513, 515,
+    517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 537, 538, 540, 541, 542, 543, 544, 545, 547, 548, 549, 550, 551,
+    554, 555, 556, 557, 558, 559, 560, 561, 563, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 579, 582, 583, 0, 1, 2, 3, 4, 5, 6, 9, 10, 11,
+    12, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 28, 29, 30, 31, 32, 34, 36, 37, 38, 39, 40, 41, 42, 45, 47, 50, 51, 52,
+    53, 54, 55, 56, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82, 83, 84, 85, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 120, 121,
+    122, 123, 124, 125, 126, 127, 128, 129, 130, 132, 134, 135, 136, 137, 138, 139, 140, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+    159, 160, 162, 163, 164, 165, 166, 167, 168, 169, 170, 172, 173, 174, 175, 176, 177, 178, 179, 180, 182, 184, 185, 186, 188, 189, 190, 191, 192, 193, 194, 195,
+    205, 214, 216, 217, 218, 219, 220, 228, 230, 231, 232, 233, 234, 235, 240, 244, 245, 246, 247, 248, 249, 250, 254, 255, 256, 257, 258, 260, 261, 263, 267, 268,
+    269, 270, 271, 272, 274, 275, 276, 278, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 297, 298, 300, 301, 302, 303, 304, 305, 309, 312, 313, 314, 315,
+    316, 317, 318, 319, 325, 326, 327, 328, 329, 330, 331, 332, 339, 340, 341, 342, 343, 344, 347, 351, 353, 354, 355, 356, 358, 359, 361, 365, 366, 367, 368, 369,
+    370, 372, 373, 374, 375, 381, 383, 384, 386, 387, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 408, 409, 410, 412, 414, 415, 416,
+    417, 418, 419, 420, 421, 423, 425, 426, 428, 429, 432, 433, 434, 436, 438, 439, 440, 441, 443, 445, 446, 447, 449, 450, 451, 453, 455, 456, 457, 458, 459, 460,
+    461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 486, 487, 488, 489, 491, 492, 493, 494, 496,
+    497, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 511, 512, 513, 514, 515, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 529, 530, 531, 532,
+    533, 534, 535, 536, 537, 539, 541, 542, 543, 544, 545, 547, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 561, 562, 563, 564, 565, 567, 568, 569, 570,
+    571, 572, 573, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 15, 18, 19, 20, 21, 22, 23, 24, 25, 26, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 40, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 61, 62, 63, 64, 65, 66, 67, 69, 70, 71, 72,
+    73, 74, 76, 78, 79, 80, 81, 83, 84, 85, 86, 87, 89, 91, 92, 93, 96, 97, 98, 99, 102, 103, 107, 108, 111, 112, 113, 114, 115, 116, 119, 120,
+    121, 124, 125, 127, 128, 130, 131, 132, 133, 134, 135, 136, 137, 139, 140, 141, 142, 143, 144, 148, 150, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162,
+    166, 167, 169, 170, 171, 172, 174, 175, 176, 177, 181, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 202, 203, 208, 212, 213, 216, 219, 225, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 253, 254, 255, 257, 258, 259, 260, 261, 262, 263, 264, 265, 268,
+    269, 270, 271, 272, 273, 274, 276, 278, 282, 284, 285, 286, 287, 288, 290, 291, 292, 296, 297, 298, 299, 300, 302, 303, 304, 305, 306, 308, 311, 312, 313, 314,
+    315, 316, 317, 318, 319, 320, 323, 325, 326, 327, 329, 330, 331, 332, 333, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 350, 353, 354, 355, 357,
+    358, 359, 366, 367, 368, 369, 370, 372, 373, 374, 375, 378, 383, 385, 386, 387, 393, 394, 395, 396, 397, 398, 400, 401, 402, 403, 404, 405, 407, 408, 409, 411,
+    412, 413, 414, 415, 416, 417, 418, 419, 422, 423, 424, 425, 426, 427, 429, 431, 435, 436, 437, 438, 439, 441, 442, 443, 444, 445, 446, 449, 450, 452, 453, 454,
+    455, 456, 457, 458, 459, 460, 461, 463, 464, 465, 466, 467, 469, 470, 471, 472, 474, 475, 477, 478, 479, 480, 483, 484, 485, 487, 489, 492, 493, 494, 496, 498,
+    501, 502, 505, 506, 507, 508, 509, 510, 511, 512, 513, 515, 516, 517, 522, 524, 525, 526, 528, 529, 530, 533, 535, 536, 538, 539, 540, 541, 542, 543, 544, 545,
+    547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 558, 561, 563, 564, 565, 566, 568, 569, 570, 571, 572, 573, 578, 579, 580, 581, 582, 583, 584, 0, 1, 4,
+    8, 11, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 33, 34, 35, 36, 37, 38, 39, 42, 43, 44, 45, 46,
+    47, 49, 50, 51, 52, 53, 54, 56, 57, 58, 59, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 81, 82, 83,
+    84, 85, 86, 87, 89, 90, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 135, 136, 137, 139, 140, 141, 142, 143, 145, 146, 147, 148, 151, 152, 153, 154, 155, 156,
+    158, 159, 161, 162, 163, 166, 167, 168, 169, 170, 171, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 186, 188, 189, 190, 191, 192, 193, 194, 195,
+    199, 206, 210, 214, 215, 216, 217, 218, 219, 220, 221, 223, 227, 229, 230, 231, 233, 234, 235, 239, 241, 242, 243, 244, 245, 246, 249, 250, 251, 254, 255, 256,
+    257, 258, 259, 260, 261, 262, 263, 264, 268, 269, 270, 271, 272, 273, 274, 275, 276, 278, 279, 281, 282, 283, 284, 285, 287, 288, 289, 290, 291, 292, 293, 295,
+    297, 298, 299, 301, 302, 304, 305, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 324, 325, 326, 327, 328, 329, 330, 331, 332, 335, 338, 339, 340,
+    341, 344, 345, 347, 349, 352, 356, 357, 358, 359, 362, 363, 364, 366, 370, 372, 373, 382, 383, 385, 386, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 403,
+    404, 405, 406, 407, 408, 409, 411, 412, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 426, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 440,
+    442, 447, 448, 449, 450, 451, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 481,
+    482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 495, 497, 498, 499, 500, 501, 502, 503, 504, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516,
+    517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 529, 530, 531, 532, 533, 534, 535, 536, 541, 542, 543, 544, 545, 546, 548, 549, 550, 551, 553, 555, 556, 557,
+    558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 573, 574, 578, 582, 585, 586, 6, 16, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 31, 32, 33, 34, 35, 36, 38, 40, 41, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 70, 71, 72, 73, 74, 75, 77, 78, 79, 81, 82, 83, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 99, 101, 102,
+    103, 105, 106, 108, 110, 111, 113, 116, 117, 118, 119, 120, 121, 123, 124, 127, 128, 129, 130, 131, 132, 133, 134, 135, 137, 138, 139, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 151, 152, 153, 155, 156, 157, 158, 160, 161, 162, 164, 165, 166, 169, 170, 171, 172, 173, 174, 175, 176, 177, 179, 180, 183, 184, 185, 186,
+    187, 188, 189, 190, 191, 192, 193, 202, 203, 204, 205, 212, 214, 217, 218, 219, 221, 222, 228, 229, 230, 231, 232, 235, 236, 242, 243, 244, 245, 246, 247, 248,
+    249, 250, 255, 258, 259, 260, 261, 263, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 279, 282, 283, 284, 287, 288, 289, 290, 291, 296, 297, 298, 299, 300,
+    301, 302, 303, 304, 305, 306, 310, 311, 312, 313, 314, 315, 320, 324, 325, 326, 327, 328, 329, 331, 332, 333, 334, 338, 339, 340, 341, 342, 343, 344, 345, 346,
+    347, 348, 352, 353, 355, 356, 357, 358, 360, 361, 362, 367, 368, 369, 370, 371, 372, 374, 375, 395, 396, 397, 399, 400, 401, 402, 403, 405, 408, 409, 410, 411,
+    412, 413, 414, 415, 417, 418, 419, 421, 422, 423, 424, 425, 426, 427, 428, 429, 431, 432, 433, 436, 437, 438, 439, 440, 441, 442, 443, 446, 447, 449, 450, 451,
+    452, 453, 454, 455, 456, 457, 458, 459, 461, 463, 464, 465, 466, 467, 468, 470, 471, 472, 474, 475, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488,
+    489, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 506, 507, 508, 509, 510, 512, 513, 514, 515, 516, 519, 520, 521, 522, 524, 528, 529, 530,
+    533, 534, 535, 536, 537, 538, 539, 540, 542, 543, 544, 545, 549, 550, 551, 553, 554, 555, 556, 557, 558, 564, 565, 566, 567, 568, 569, 570, 572, 577, 2, 3,
+    4, 7, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 60, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 77, 78, 79, 82, 83,
+    84, 85, 88, 89, 91, 92, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 109, 111, 112, 113, 114, 115, 116, 118, 119, 120, 121, 122, 123, 124, 125,
+    126, 127, 128, 129, 130, 131, 132, 134, 135, 136, 137, 138, 139, 140, 141, 142, 144, 145, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+    161, 162, 163, 165, 166, 167, 168, 169, 170, 172, 173, 174, 175, 176, 177, 178, 179, 180, 182, 183, 184, 185, 186, 187, 189, 190, 191, 192, 193, 194, 195, 215,
+    227, 228, 229, 230, 231, 233, 234, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 254, 255, 256, 257, 258, 259, 261, 262, 263, 264, 267, 268, 269, 270, 272,
+    273, 274, 275, 282, 284, 285, 286, 288, 289, 290, 291, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 310, 311, 312, 313, 314, 316, 317, 324, 325, 326,
+    327, 328, 329, 330, 331, 332, 334, 338, 339, 340, 342, 343, 344, 346, 347, 354, 355, 356, 357, 358, 359, 360, 366, 367, 368, 370, 371, 372, 373, 374, 375, 382,
+    385, 388, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 410, 411, 413, 414, 415, 416, 418, 419, 421, 422, 428, 429, 431, 432,
+    433, 434, 436, 437, 438, 439, 440, 442, 443, 444, 446, 447, 448, 449, 450, 451, 452, 453, 454, 456, 457, 459, 461, 462, 463, 464, 465, 466, 468, 469, 470, 471,
+    472, 473, 474, 475, 476, 477, 478, 479, 481, 482, 483, 484, 487, 491, 492, 493, 495, 497, 498, 500, 501, 503, 504, 505, 506, 507, 511, 512, 513, 514, 515, 516,
+    517, 518, 519, 520, 521, 522, 523, 525, 526, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 553,
+    554, 555, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 570, 571, 572, 573, 574, 575, 576, 577, 579, 580, 584, 586, 18, 19, 20, 22, 23, 24, 25,
+    26, 27, 29, 30, 31, 32, 33, 36, 38, 39, 40, 41, 42, 43, 44, 45, 46, 48, 49, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 74, 75, 78, 79, 80, 82, 83, 84, 85, 86, 87, 88, 90, 92, 93, 94, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    106, 107, 108, 109, 110, 111, 113, 114, 115, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 132, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 146, 147, 148, 149, 151, 153, 154, 155, 156, 158, 160, 161, 163, 164, 165, 166, 167, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 181, 183, 184,
+    185, 187, 190, 192, 193, 194, 215, 216, 218, 219, 220, 222, 227, 228, 229, 230, 231, 232, 233, 234, 240, 241, 242, 243, 244, 245, 246, 247, 248, 250, 254, 255,
+    257, 258, 259, 263, 264, 265, 268, 269, 270, 271, 272, 273, 274, 276, 278, 283, 284, 285, 286, 287, 289, 290, 291, 297, 298, 299, 300, 301, 302, 303, 304, 306,
+    311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 325, 327, 328, 329, 330, 331, 332, 333, 334, 338, 339, 340, 341, 342, 344, 345, 348, 352, 353, 354, 355, 356,
+    357, 358, 361, 366, 367, 368, 369, 370, 372, 373, 383, 393, 394, 395, 396, 398, 401, 404, 405, 407, 408, 409, 411, 412, 413, 415, 416, 417, 418, 419, 422, 424,
+    425, 426, 428, 429, 431, 432, 433, 435, 436, 438, 439, 441, 442, 444, 446, 449, 450, 452, 453, 454, 455, 456, 457, 459, 460, 461, 463, 464, 465, 467, 468, 469,
+    471, 472, 475, 477, 478, 479, 480, 481, 482, 483, 485, 486, 487, 488, 489, 491, 492, 493, 494, 495, 496, 500, 501, 502, 503, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 515, 516, 517, 519, 520, 521, 522, 523, 526, 529, 530, 531, 534, 535, 536, 539, 541, 542, 543, 544, 548, 549, 551, 552, 554, 556, 557, 558, 559,
+    562, 563, 564, 565, 566, 567, 568, 569, 570, 573, 579, 580, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 61, 62, 63, 64, 65, 66, 68, 69,
+    70, 71, 72, 74, 75, 76, 77, 78, 80, 81, 83, 84, 86, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 101, 102, 103, 104, 105, 107, 108,
+    109, 110, 111, 112, 114, 115, 116, 117, 118, 119, 120, 121, 123, 124, 125, 126, 127, 128, 129, 132, 133, 134, 136, 137, 138, 139, 140, 141, 142, 144, 145, 147,
+    148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 162, 164, 165, 166, 167, 168, 169, 171, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+    188, 189, 191, 193, 194, 195, 212, 228, 231, 233, 234, 235, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262,
+    263, 267, 269, 270, 271, 272, 274, 275, 276, 277, 278, 281, 282, 283, 284, 285, 286, 287, 288, 291, 292, 293, 296, 297, 298, 299, 300, 301, 302, 303, 304, 309,
+    310, 311, 312, 314, 315, 316, 317, 319, 320, 325, 326, 327, 329, 330, 339, 340, 341, 342, 344, 345, 352, 353, 354, 355, 356, 357, 358, 359, 360, 368, 370, 371,
+    372, 375, 376, 377, 384, 385, 386, 388, 393, 394, 395, 400, 404, 405, 407, 409, 410, 411, 412, 413, 414, 415, 416, 417, 419, 421, 422, 423, 424, 425, 427, 428,
+    430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 445, 446, 447, 449, 450, 451, 452, 453, 454, 455, 456, 459, 460, 464, 465, 466, 467, 469,
+    471, 473, 474, 475, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 491, 492, 493, 494, 495, 497, 498, 499, 500, 501, 502, 505, 506, 507, 508,
+    509, 510, 511, 512, 513, 514, 515, 516, 519, 520, 522, 523, 525, 526, 527, 528, 530, 531, 533, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 548, 549,
+    551, 553, 554, 555, 556, 557, 558, 561, 562, 563, 564, 565, 566, 567, 569, 572, 578, 582, 584, 585
+};
+const float convnet_sparse_fc1_values[CONVNET_SPARSE_FC1_NNZ] = {
+    0.10801177, 0.12625371, 0.112105526, 0.092653275, 0.115069866, 0.11484961, 0.117691375, 0.10733637,
+    0.09374591, 0.09223022, 0.42264393, 0.46074015, -1.1915727, 0.34866706, 1.633822, -0.19199316,
+    -0.5781434, -0.7099545, 1.0415431, 0.8253208, -1.2681509, 1.4083645, 0.7748787, 0.990931,
+    0.38693896, -0.6001632, -1.5536506, 0.3281005, -1.056497, 0.31114364, -0.328726, -0.36647695,
+    -0.21620871, -0.6294276, -0.4238541, -0.53655505, 0.18677552, 0.3678058, -1.2308526, -1.3869177,
+    -0.6250245, -0.18217942, -0.61859894, 0.23985454, -0.25018397, -0.10827205, -0.12611377, -0.6202881,
+    1.1628133, 1.9279834, -1.5043548, -1.1907805, -0.21730392, 0.19203135, -0.28985813, -0.49225253,
+    -0.5045102, -0.18256491, 0.3002389, -1.0439738, 1.2017144, 0.7840713, 0.16205984, -1.1896116,
+    0.48909792, -0.28561193, -0.31315854, -0.19369455, -0.3701609, -0.37662563, -0.55965954, -0.35611805,
+    -1.8327621, 0.36086842, -1.2727454, 0.20289944, 0.30517253, -0.5339404, -0.21913129, -0.46176407,
+    0.17229055, -0.6121248, -1.8187617, 0.40985528, -0.47758055, -0.69877774, 0.23814037, 0.16662978,
+    -0.5339993, -0.1060217, -0.6545815, -0.5636835, 0.20265615, 0.275336, -0.12949406, -0.13670647,
+    0.4075439, -0.55648, 0.713079, 0.11551695, 0.23816934, -0.7360453, -0.93448055, -0.45999914,
+    0.20024575, 0.16244555, -0.12253305, 0.39660317, -0.6515558, -0.16160904, 0.46405843, -0.6580618,
+    -0.49500483, 0.23725246, -0.3921663, 0.18831207, 0.39120427, 0.27074638, 0.8800334, 0.7457034,
+    -0.5841523, -0.4301074, -0.23162536, 0.21481669, 0.11024412, -0.33932424, 0.24288148, 0.21234341,
+    0.32413515, -1.1766888, -1.3505322, -1.0440674, -0.34649992, -0.48971018, -0.23801892, 0.17470422,
+    0.311907, 0.12289152, 0.26092488, 1.4324799, -0.14142855, 0.62938374, 0.4207385, -1.7427045,
+    0.3555612, -0.122383535, -0.4774605, -0.4748159, 0.29855162, -0.19387203, -0.25689548, 0.19531667,
+    -1.840495, 0.36266053, 0.42484868, 0.35032988, -2.3309193, -0.53573143, -0.37830865, -0.72689086,
+    -1.4069858, -0.73770964, -1.9710983, -2.054209, -1.9253576, -0.23918408, 0.35595575, 0.32696408,
+    0.09084941, -0.17731287, 0.08900334, 0.20019193, -0.16924848, 0.088583805, 0.08682451, 0.08868537,
+    0.112218365, 0.17494695, 0.09156259, 0.44685572, -0.30797932, -0.16514236, -0.10100299, -0.10664813,
+    0.09856203, 0.12674926, 0.14685428, 0.08693561, 0.2685444, -0.20396009, 0.23540986, 0.66631794,
+    -0.16727431, -0.09969736, -0.17156978, -0.15857606, 0.08689145, 0.33234563, -0.42182025, -0.14782695,
+    0.09484791, -0.1707838, -0.4312796, -0.8653896, -0.9379503, -0.23419084, 0.28735277, 0.093444616,
+    0.53217083, 0.5627076, -0.3140123, -0.64553386, -0.7195984, 0.3782305, -0.679707, 0.16808103,
+    0.12637894, -0.08511355, 0.25032994, 0.10478826, 0.48389274, 0.63575363, -0.39333934, -0.4102943,
+    -0.2604961, 0.28133905, -0.71140057, -0.397125, -0.52571416, 0.08732452, 0.58839315, 0.52883744,
+    0.3298694, -0.28497013, -0.25829974, 0.09472866, 0.085704215, 0.31127056, -0.11367147, -0.9471479,
+    -0.91285247, -0.26298782, 0.2724343, 0.6814337, 0.40928966, 0.51066077, -0.18613198, 0.13105477,
+    0.12547925, 0.12970869, -0.4951332, -1.1485046, -1.767242, -0.4442361, 0.81663156, 0.50254285,
+    0.7285412, 0.33120236, -0.11410161, -0.19852275, 0.11713067, -0.097458445, -0.26202452, -0.65990704,
+    -1.0255595, -1.2070012, -0.4257893, 0.6019219, 0.21842387, 0.41295832, 0.22019278, 0.21049397,
+    0.104707904, 0.12791413, -1.0806819, -0.50167525, -0.4151173, -0.37596193, 0.15006092, -0.14580588,
+    0.24374264, 0.09479176, -0.08876274, 0.09500492, 0.19579239, 0.36977106, 0.12796822, 0.22516425,
+    0.10499082, 0.10876978, 0.087314494, 0.1353866, 0.16349186, 0.15087904, 0.08489666, 0.09185744,
+    0.32633168, 0.3531445, 0.30568805, 0.106916495, -0.48772383, -1.4368415, -1.0495096, -0.16368134,
+    0.22245964, 0.25717768, 0.27650666, 0.15967226, 0.22588284, -0.6219974, 0.39174494, 0.11858229,
+    -0.3601422, -0.27856612, 0.32679713, 0.26284444, 0.08471793, 0.096373335, 0.27838144, -0.11000801,
+    0.35047677, -0.32085255, 0.24074845, 0.2741122, 0.14009707, 0.26686096, -0.21035777, -0.34605104,
+    0.30208787, 0.26094523, -1.0078912, -0.9994558, 0.21058391, -0.34951353, -0.36519834, 0.43615398,
+    0.10549273, 0.13962133, 0.5355994, 0.2780093, 0.5790256, 0.09161576, 0.65763193, -0.23893848,
+    0.3056232, -0.26858124, 0.45589685, -0.49654132, 0.48518264, 0.29804468, 0.5596712, -0.92656744,
+    0.15300123, 0.45193377, -1.0857494, -0.6762676, -0.16963619, -0.21650127, -0.5484856, -0.27366164,
+    -0.16373046, -0.12537625, 0.8300133, -0.86957335, 0.09128947, -0.13949288, 0.72727287, -0.3655689,
+    -0.22005624, -0.30170524, -0.24692166, -0.37333784, -0.46349663, -0.2730737, -0.25440985, 0.16585812,
+    0.54197776, -0.35645762, -0.8951993, -0.9077443, -0.5577709, 0.39619392, -0.6955135, -0.10256274,
+    -0.33926332, -0.18152255, -0.23981394, 0.09473336, -0.8237569, -1.0193456, -0.39129317, -0.614709,
+    -1.4291997, -0.7861343, 0.33922902, 0.15228641, -0.45203283, -0.58258194, -0.38260457, -0.31818694,
+    -0.08575699, 0.11948354, 0.5395723, -0.3315423, -0.23100834, -1.1392658, -0.5046771, -1.2970761,
+    -0.32339594, -0.21673606, -1.4896432, -0.742166, 0.113898024, 0.30261177, 0.38339442, -0.8114912,
+    -0.75879717, -1.1974522, -0.44036227, 0.38190272, 0.12402177, 0.48322144, -0.87552637, 0.8288179,
+    0.15245579, 0.97847193, -0.46616063, -0.48509946, -1.1260837, -0.10882445, -0.6106244, 0.33677885,
+    0.15313053, 0.3759161, 0.45552048, 0.36888647, 0.7268676, 0.90851, 0.24512756, 0.55720454,
+    0.3616091, 0.76519, 0.2664075, 0.30839893, 0.37022504, 0.085699424, 0.094081014, 0.13164172,
+    0.118701324, 0.12169602, 0.11192437, 0.13262005, 0.12588733, 0.10393888, 0.09257126, 0.14051366,
+    0.100780405, 0.14098452, 0.1584379, 0.124157675, 0.11127749, 0.1909778, 0.13861193, 0.08572609,
+    0.13851286, 0.111573726, 0.1558013, 0.7278305, 0.81806016, -0.34601766, 0.5792261, 0.36791635,
+    0.45997757, -1.1672349, -3.8131807, -3.0901384, -2.238039, 0.9751603, -0.45390794, 0.744364,
+    0.65193707, 0.92557245, 0.37309176, -1.0296636, -1.8404299, -0.92509323, -1.5940516, -1.250275,
+    0.82585937, -0.7748081, -0.7485322, 0.60531217, -0.82055223, 0.46427697, 0.75672203, 0.4665884,
+    0.29826465, -0.33150086, -0.19193104, -0.99985504, -0.3529927, -0.6993951, -1.1845865, -0.23193459,
+    -0.42070144, -0.19292536, -0.98890096, -1.3726373, 0.63253796, -1.0663906, 0.09455971, -1.2392236,
+    0.09947497, -0.1558887, -0.3644157, -0.26086777, -0.87875533, -0.08793152, 0.18489715, -0.18196326,
+    -0.9051706, -1.3755875, 0.72572553, -2.3839529, 0.49439386, 0.3842494, -0.42499584, -0.20276225,
+    -0.8530783, 0.74375325, 0.59414035, -0.26006618, 0.84621465, 1.1929791, -1.1234182, -0.20837477,
+    -0.15828542, -0.3126915, -0.8046319, -0.4150528, -0.60791445, -0.20841415, -1.2125462, -0.9044472,
+    0.69206405, 0.580752, 0.5204275, 1.063499, 0.38177347, 0.09530836, -0.88570476, -0.28550127,
+    -0.21882989, 0.16606455, 0.1657448, 0.48721436, -1.3363061, 0.6572115, -0.23295571, -0.8336366,
+    0.5719788, 0.13153958, -0.8426592, -0.21870829, -1.253606, -0.15672192, 0.44755426, -0.42464927,
+    -0.44381735, 0.6687254, -1.416096, -0.7200831, 1.097169, -0.26659572, -0.5411471, -0.29180548,
+    -0.529316, -0.7103503, -0.63713914, 0.59215015, -0.483411, -0.58451015, 1.4201283, 0.6649483,
+    -0.5913268, 0.1654511, -0.295332, -0.34638306, -0.10544756, 0.12902157, 0.36375692, -0.09741701,
+    -0.7676188, -0.95700914, 0.56154686, 0.2124438, -0.4850875, -0.2316716, -0.27491504, -0.41559145,
+    0.1369681, -0.3744156, -0.14102797, 0.7278019, 0.6483747, 0.26898444, -0.15876585, 0.2930789,
+    -0.43046388, 0.34368765, -0.1129142, -0.84690434, -0.85250306, 1.0382282, 0.71895707, 0.17582205,
+    -0.6469517, 1.0128537, -0.38728642, -0.4309716, -0.8918457, -3.580263, -1.1871091, -0.20981823,
+    0.71515954, 0.69526494, 0.2045607, 0.08846622, 0.09563588, 0.15639536, 0.18402146, 0.16181059,
+    0.28161103, 0.3115038, 0.116521575, -0.29020008, -0.13373268, 0.20212086, 0.28006518, 0.09151827,
+    -0.13772404, -0.35780394, -0.83564794, -0.11968579, -0.31707042, 0.3598528, 0.09443968, 0.09558121,
+    0.31282592, 0.10460671, 0.47699752, 0.33265248, 0.37165633, 0.15761885, -0.22625916, 0.6733876,
+    0.8378725, -0.08764744, 0.16546088, 0.30582434, 0.4583414, 0.35912687, -0.23549134, -0.094747074,
+    0.48379374, 0.40512714, 0.14386207, 0.29779097, 0.31491324, 0.6474467, -0.13980368, -0.907494,
+    0.16390818, 0.3438557, -0.08688713, 0.30246884, 0.366398, 0.2884779, 0.25833848, -0.37728372,
+    -0.095529296, 0.12246822, 0.12102309, 0.65814346, 0.10344656, -0.18055528, 0.106351376, 0.18026291,
+    0.20739184, -0.31302446, 0.18578556, 0.12882033, -0.49893323, -0.50123477, -0.10807771, -0.30425867,
+    0.19465713, 0.2476779, 0.30948114, 0.098945595, 0.14800654, 0.20754443, -0.22888923, 0.21317741,
+    0.6447898, 0.1815288, 0.24744865, 0.08827192, 0.112651736, -0.08510659, -0.48844686, -0.80644935,
+    0.4177156, 0.98757124, -0.14781202, 0.3508649, 1.25121, -0.11520081, -0.09622713, 0.806225,
+    -0.6434551, -0.122878864, 0.7172906, -0.10631184, -0.1075505, 0.08399122, 0.08501246, 0.45832455,
+    -0.16123827, 0.1135839, 0.7722136, 0.25522122, -0.322641, 0.08960015, -0.25239035, -0.4408246,
+    -0.11145999, 0.10862122, 0.2079472, -0.6763864, 0.13495459, 0.19127244, 0.34513003, 0.48055366,
+    -0.25753838, 0.1599014, -0.35958433, -0.5480446, -0.29034466, -0.08811645, -0.5789384, -0.45480916,
+    -0.5241404, 0.087339446, -0.2250507, -0.6274751, 0.24474831, 0.4149781, -0.29340708, -0.21724951,
+    -0.86357445, -0.54259944, -0.7071794, -0.9642089, -0.52652586, -0.22560282, 0.14989996, -0.798695,
+    -0.29300144, -0.7510529, -0.4479128, 0.15543127, -0.80277824, -0.851878, -0.877108, -0.27165455,
+    0.117523775, -0.20370065, -1.6103227, -0.49565655, -1.6248147, -0.4934111, -0.2864116, -0.6256558,
+    -0.7579896, -0.45215625, 0.5804155, -0.47923288, 0.0866961, 0.089499295, 0.20231369, -0.31888863,
+    0.36922684, -0.40759736, -1.4093902, -0.18977246, -0.80412287, -0.6782715, 0.15108268, -0.5515616,
+    -0.19371687, 0.09597459, -0.23207821, -0.938973, -0.53881556, 0.300468, -0.14710252, -1.4831471,
+    -0.5017942, -0.30871254, 0.13339452, 0.51885414, 0.13852826, 0.17925145, -0.6504618, 0.09392916,
+    0.35428855, -0.15373458, -0.37306315, -0.14088821, 0.200539, 0.4095308, -0.095313564, 0.22432429,
+    0.29832774, 0.5425672, 0.63841695, 0.810158, 0.2612472, 0.26193997, -0.29611778, -0.12445442,
+    0.49643853, 0.10411472, 0.6198831, 0.6144644, -0.44247583, 0.14164083, -1.2369752, -1.3781873,
+    0.4224631, -0.7716272, -1.2933961, 0.92022365, 0.17876157, -0.12183288, 0.961483, -0.18672584,
+    -0.30689484, -0.2840866, 0.2942456, 1.2849648, 1.107001, 0.59251946, -0.8006993, -0.097564794,
+    0.1295355, 0.10230649, 0.1360595, 0.109242745, 0.11331144, 0.11437829, 0.14813405, 0.101413995,
+    0.11741873, 0.083394125, -0.15546702, -0.08692469, -0.7160403, -0.8820627, -1.0080823, -0.14825453,
+    -0.12829609, -0.75475794, 0.59618753, 1.963059, 0.2859052, -0.53419733, -2.8395424, -0.21726504,
+    -0.14383641, -0.74934375, -0.7509486, -1.7525918, -0.3341154, 1.1066588, -0.13673344, 0.25263298,
+    -0.11449088, -0.08599336, 0.4380392, -0.59126276, -1.7748748, -0.83751714, -0.94256145, -0.6329125,
+    0.48706982, 0.11825333, 0.13153853, 0.10629752, -0.088093825, -0.9149186, -0.3383428, -0.43557575,
+    -0.56924784, -0.63898414, 0.7240237, 0.20565514, 0.091721036, -0.11528013, -0.17579083, -0.35632253,
+    -0.25896618, -1.9628627, -1.0819889, 0.17993729, 0.6324181, 0.34422594, 0.16928497, 0.11227632,
+    -0.08909952, 0.10343255, -0.22231308, -0.2998237, 0.43270293, -1.3062643, -0.12064166, -0.9927414,
+    -0.73305386, 0.5554615, 0.24794883, 0.14773704, 0.21965708, -0.48757857, -0.15319033, -0.16230991,
+    0.5051311, -0.7500765, -0.8386386, -0.21451189, -0.3636817, 0.21521717, -0.42354816, 0.13429873,
+    -0.5484307, 0.11816088, 0.3069051, 0.35360864, 0.58612514, 0.12005619, -1.1213655, 0.22026804,
+    -0.82009935, 0.22595794, 0.11017169, 0.12045547, 0.14108725, 0.5340177, 0.30517688, 0.7356776,
+    -0.53235924, 0.8513763, 0.20495705, 0.38886464, 0.41418368, 0.10241533, 0.23087946, -0.10016802,
+    0.28375867, 0.39321485, -0.1724594, -0.61833495, 0.29930767, 0.3795328, 0.3618451, 0.08483779,
+    0.38120887, 0.29549903, 0.14168957, 0.4556984, 0.97292894, 1.541913, 1.1184936, 0.22181724,
+    0.15278685, 0.1380578, -0.60195935, 0.69045794, 0.22644919, 0.17821069, 0.19131698, 0.35741943,
+    0.22788122, -0.15495923, -0.26571408, -0.21691638, -0.56560254, -0.12210276, 0.24828114, -0.7213796,
+    -1.1895764, -0.5539122, -0.5651777, -0.36236086, -0.39869544, 0.17267981, -0.5317065, -0.8251182,
+    -0.1816118, -0.7631077, -1.0650244, -0.7010355, -0.19232714, -0.10703539, -0.17458676, -0.10422799,
+    -0.4236524, -0.28455234, 0.21110743, -0.5434099, -0.45935187, -0.48048097, -0.21813712, -0.17292976,
+    -0.27570602, 0.13032372, -0.091660045, -0.4229171, -0.566096, -0.56400466, -0.11896265, -0.33803508,
+    -0.16563354, 0.089883514, 0.5230846, -0.51536405, 0.19006227, 0.09019135, 0.1569238, -0.1380055,
+    0.13384542, -0.16395341, -0.12991062, 0.15208142, 0.239242, 0.28177747, 0.38267958, -0.1958514,
+    0.1208284, 0.092639185, 0.40646008, 1.1227833, 0.7252444, 0.74212164, 0.65626806, 0.41420278,
+    -0.32714024, 0.2683685, 0.2275403, 0.37682962, -0.13714547, 0.49416083, 0.34652048, 1.133946,
+    1.0703051, 0.19024391, 0.90358883, 0.24406339, 0.09781065, 0.49254328, 0.093663566, 0.21691957,
+    0.3826883, 0.3157323, 0.36418906, 0.5604801, 0.41375998, -0.21751794, -0.10534466, -0.2738491,
+    -0.47779444, -0.25107637, -0.48447728, -0.44911996, -0.087371185, 0.5104408, -0.27671698, -0.28737524,
+    -0.16532555, -0.68808097, -0.70596933, -0.7425303, -0.66234297, -0.41428828, 0.17351879, 0.2153517,
+    -0.10290302, -0.22468063, -0.18539062, 0.18784294, -1.0980844, -1.0136868, -0.39247218, -0.3533119,
+    0.088493, -0.15072873, 0.20991643, 0.3011497, -0.14508995, 0.12322753, 0.2683998, -0.25498113,
+    -0.53617746, -0.11023858, 0.26881447, 0.13436642, 0.11300173, 0.17070255, 0.08952554, -0.14816481,
+    -0.5216123, -0.57840735, -0.47861898, 0.37096453, 0.89552605, 0.3442586, -0.5471219, 0.08854778,
+    -0.3906895, -1.2686677, 0.44584617, -0.25942615, -0.6472034, -0.4821385, 0.5415432, -0.13840899,
+    0.2371075, 0.102326475, -0.27307212, -0.5617039, 0.25282738, -0.55565816, -0.43727288, -0.11257983,
+    -0.09131005, -0.14945887, 0.2002644, -0.38715878, -1.0525239, -0.1509263, 0.15244299, -0.21933672,
+    -0.49479246, 0.31360555, -0.40638113, 0.09911897, 0.3108159, -0.22542039, -0.093688786, -0.39928603,
+    -1.3323407, -0.59100443, -0.14667542, 0.7117061, -0.6342339, 0.39157408, -0.5453011, -0.15446994,
+    0.2802266, -0.091487974, -0.48519993, -0.56220406, -1.1524029, 0.18557386, 0.45556846, 0.51182806,
+    0.42819977, -0.18587828, -0.47958517, -0.5176298, -0.4624823, 0.19178428, -0.09644417, -0.26064703,
+    0.5994642, 0.50990635, 0.89105254, 0.44312638, 0.14379905, 0.21233663, 0.14485623, -0.42225027,
+    -0.8182756, -0.20666346, -0.6474802, 0.36604604, -0.09946114, 0.19918694, 0.47258866, 0.4074837,
+    0.23538752, -0.32518554, 0.11835241, 0.17750305, -0.43873963, -0.36503825, 0.22462611, 0.25342804,
+    -0.12652239, 0.12915926, -0.2586984, -0.43725437, -0.3385547, -0.12834594, -0.3849888, 0.33679086,
+    0.9449764, -0.15252665, 0.1680963, -0.42815995, -0.47343597, -0.7673934, -0.15143192, -0.3953191,
+    -0.13572705, 0.26979968, 0.25184545, 0.24478754, 0.41480482, -0.13966689, -0.1652179, -0.12551166,
+    -0.57116723, -0.7174867, -1.1877764, -0.44315827, -0.3424223, 0.17514604, 0.49390316, 0.76585406,
+    0.95647675, 0.44220865, -0.35785338, -1.0266045, -0.20079222, -0.51051426, -0.26915637, -0.24843866,
+    0.48368737, 0.8698878, 0.513541, 0.2886585, 0.35897744, 0.093618914, -0.1347873, -0.40617907,
+    -0.6223363, 0.7514893, 0.490593, 0.18877272, 0.9571437, 1.1511593, 1.2261413, 0.33570528,
+    -0.7802248, -0.4091266, -0.08552223, 0.11175503, 0.15056065, 0.10268531, -0.103971854, -0.1375911,
+    -0.086250484, -0.10462999, -0.11004351, -0.14004724, -0.12644629, -0.085116655, -0.14034544, -0.13513118,
+    -0.099129446, -0.13267277, -0.14774679, -0.34852213, -0.35271528, 0.26250473, 0.73513293, -0.4620174,
+    -0.9661304, -0.6596708, -2.0207303, -0.26375854, -0.8086494, -0.24174258, 0.11918274, 1.1151274,
+    0.6005661, 0.24027869, 0.2755824, 0.501688, 0.4224645, -0.17879182, -0.43638644, -1.0941799,
+    -2.7199323, -0.19342978, -0.15577161, 0.5181096, 0.13395324, -0.17777276, -0.14277136, -0.23993407,
+    -0.49908596, -0.848731, -1.5143826, -0.9292567, 0.8733711, 0.4728744, 0.09984885, 0.17589924,
+    0.13144596, 0.20009612, 0.20525101, 0.089857444, -0.38503936, -0.58430064, -0.16148956, -2.3100817,
+    0.7820345, 0.70677274, 0.16389474, 0.48738515, 0.28505784, 0.25204775, 0.30503476, 0.14223972,
+    0.5083046, 0.35492972, 0.22443384, -0.92871153, -0.32647276, -0.50552475, -0.4298002, 0.41791475,
+    0.17974322, 0.15680116, 0.28410777, 0.35883597, 0.4478527, 0.5229272, 0.22006181, 0.35146636,
+    -0.17739882, -0.5896982, -0.76322466, -0.18567681, 0.15817378, -0.27573773, 0.23433453, -0.10896381,
+    0.38283107, 0.19112323, 0.1621923, -0.22320393, -0.5131914, -0.6651394, -0.37963158, 0.4077083,
+    -1.4884589, -1.4126918, -0.8967113, -0.3852483, -0.13723207, 0.1677325, 0.24467376, 0.08665213,
+    -0.38435563, -1.2280978, 0.32892305, -0.51377064, 0.54452366, -1.5038593, 0.4493007, -0.2792251,
+    -0.5611731, 0.2493198, 0.48074, -0.18443543, -0.29768535, -0.3057119, -1.1859261, -1.2856053,
+    0.8788013, -0.12445303, -0.5240334, -0.22759578, 0.2844713, 0.29823902, 0.09321782, -0.16393478,
+    -0.33214518, -0.17830488, -1.257159, -0.9023279, -0.30824715, -0.11380658, 0.19593821, 0.3341994,
+    0.1244216, 0.21768641, 0.29848367, -0.08950036, 0.31816542, -0.4821781, 0.15114373, -0.31040922,
+    -0.34957728, 0.33361056, -0.40697902, 0.37415075, 0.099762, 0.16087048, 0.2645617, 0.3665196,
+    0.16777062, 0.23364586, 0.6761601, 0.5244651, -0.1397035, -0.14268592, 0.4384168, -0.5807512,
+    0.14354461, -0.286679, 0.53887624, 0.649972, 0.952408, 0.19958061, -0.75706613, -0.10396214,
+    -0.092007145, -0.16210066, -0.2885595, -0.28724343, -0.5300844, -0.42957845, -0.44848958, 0.16785228,
+    -0.3515278, -0.76592064, -0.674044, -0.5089772, -0.57911783, -0.14282162, -0.29121578, -0.4012535,
+    -0.44493985, -0.5353028, -0.55906385, 0.18799101, -0.19065407, -0.21649641, 0.11821726, 0.34576696,
+    0.34823588, 0.6710134, 0.28547403, 0.12279143, 0.23449805, -0.13271871, -0.15515424, 0.22401309,
+    0.6560198, 0.773407, 0.93599993, 0.5185945, -0.43441263, -0.11900203, 0.08929674, 0.10371703,
+    -0.17396204, 0.2323142, 0.6851514, 0.68940395, 0.75249064, 0.24368139, -0.28423598, -0.3365099,
+    -1.0755364, -0.35744867, -0.106159136, 0.13855669, -0.4265991, -0.40922236, -0.77366376, -1.0273253,
+    0.30871737, 0.11473863, -0.08655476, -0.092560254, -0.23497172, -0.122951105, -0.5645419, -0.35737234,
+    -0.6625144, -0.30900094, -0.0848701, -0.13849178, 0.3155981, 0.777631, 0.2774314, -0.15422979,
+    -0.132226, -0.15133493, -0.25717908, 0.2962113, 0.4876808, 0.398174, 0.630835, 0.31485257,
+    0.26923832, 0.1387436, 0.15367892, 0.10251225, 0.425593, 0.847558, 0.8458489, 0.80890423,
+    0.428804, 0.10004671, -0.10794073, -0.17462178, -0.17098857, -0.33333004, -0.13184282, -0.21500501,
+    -0.20425591, -0.31346512, -0.48545387, -0.27764872, -0.13611387, -0.10507706, -0.28953663, -0.2626607,
+    -0.21938054, -0.18674788, -0.11653256, -0.23139383, -0.19128813, -0.19745415, -0.22600769, -0.10104752,
+    -0.13971561, -0.27783912, 0.0989059, 0.21668538, -0.62414086, -0.33523807, -0.21573552, -0.18353432,
+    -0.1223886, 0.21640232, -0.33337396, -0.16601367, -0.093153104, 0.09267819, 0.16381055, 0.2859996,
+    0.16513981, -0.54303765, -0.18727365, -0.095433146, -0.18944877, -0.29936844, 0.12102511, 0.41349643,
+    0.38448215, -0.14062454, 0.78253883, -0.39540806, -0.122394755, -0.7634932, 0.14087369, 0.57932466,
+    0.27850488, 0.25887457, -0.17797187, -0.43362492, -0.12498949, -0.63476425, 0.22092506, 0.408245,
+    0.29597875, 0.24208918, -0.08676315, 0.12158666, -0.29983526, -0.45970643, -0.29322478, -0.26024005,
+    -0.32535005, -0.095076054, 0.32992974, 1.0581843, 0.48981902, -0.29453096, 0.08644517, -0.20101616,
+    0.08843187, -0.10374952, -0.2098067, -0.3278278, -0.6144113, -0.62189966, -0.12785529, -0.119927816,
+    -0.117171496, 1.0813197, 0.23256518, -0.17846929, -0.16133974, -0.4913749, 0.21519122, 0.22862774,
+    0.1877592, 0.14087856, -0.24883239, 0.38702497, 0.91822433, 0.11654969, 0.34085885, -0.12090386,
+    0.14383149, 0.36456496, 0.16447283, 0.1502923, 0.090634115, -0.2760877, -0.11825684, 0.47510812,
+    0.4074874, 0.73480296, 0.5628386, 0.7727808, -0.10142354, 0.29937533, 0.18655938, -0.1322015,
+    0.10090653, -0.4523326, -0.10175085, 0.28562185, 0.5429588, 0.7765588, 0.69347936, 0.37279725,
+    0.17123726, 0.62961847, 0.2034272, -0.2978219, -0.57351154, 0.20921259, -0.41754404, -0.10348924,
+    -0.24107537, 1.1333661, 0.47746173, 0.16265047, 0.3289734, -0.14397584, -0.10078657, -0.19503745,
+    -1.2115374, 0.09294234, -0.27074507, 0.11396218, 0.6718894, 0.2077916, 0.22381458, -0.29441103,
+    -0.10029912, -0.24730493, -0.39836392, -0.80577624, -1.3185049, 0.26588783, -0.14173412, -0.4321313,
+    -0.47433123, 0.8736129, 1.1081039, 0.18189956, -0.5955718, -2.1623824, -0.6579147, -1.4649942,
+    -1.119351, -0.23810929, -0.1516044, -0.08589942, -0.114152454, -0.21176983, -0.15329224, -0.39686286,
+    -0.35355422, -0.13167177, -0.2513537, -0.31434178, -0.17340687, -0.09244535, -0.083676875, -0.08855678,
+    0.13101497, -0.12134276, -0.24822943, 0.58179027, -0.4635296, 1.3346913, 0.3025871, -0.19355194,
+    -0.59582394, -1.1255987, -0.4466107, 0.9125236, -1.268921, -1.6347859, -0.86778134, -0.7782296,
+    0.30520433, -0.7024568, -0.14311525, 0.45577434, 0.12717076, -0.7511553, 0.24306907, -0.4922092,
+    -0.5826431, -0.59841883, -0.58183086, -0.23980428, -0.81616324, 0.22595963, 0.5297043, -0.20819433,
+    -1.0528507, -0.33446106, 1.445423, -0.8423142, -0.5587605, -0.4036471, -0.4044828, -0.25508228,
+    -0.47053286, -0.7010589, 0.10217581, 0.37899163, 0.46861863, -1.3635954, -0.5460818, -1.0073252,
+    -0.98771966, -0.1733588, -0.117966704, -0.6299733, -0.30058727, -0.16622324, -0.2631702, -1.2694587,
+    0.8074841, 0.20909776, -0.6480365, -0.44209307, 0.096312195, -0.520982, -0.76437694, 0.15309136,
+    -0.10157622, -1.0165862, 0.42555654, -1.0030925, 0.15047973, 0.35142478, 0.4695297, 0.15492605,
+    0.48231384, 1.0706109, 0.95440537, 0.2738237, 0.23681086, 0.3907294, 0.29522213, 0.21541992,
+    0.3163689, -0.15811704, -0.1036299, 0.4952634, 0.2049113, 0.2801528, -0.177306, -0.20835827,
+    -0.091182664, -0.111394085, 0.4641614, -0.23466296, 0.5026298, -0.9651046, 0.21032414, 0.37832087,
+    -0.8154802, 0.292693, 0.44031695, -0.3186297, -0.25318545, -0.4789666, 0.20166022, -0.38347954,
+    0.55294454, 0.13950086, 0.22889061, -0.64797175, -0.3178034, -0.16226916, -0.58042216, -0.17252202,
+    -0.5384763, -1.7651039, -1.8688289, -1.3638251, -0.20528, 0.09875444, -0.317835, -0.114395596,
+    -0.584549, -0.10770678, -0.7541991, -0.08479528, 0.6201384, -1.3415202, 0.19839755, -0.1353994,
+    -0.2114364, -0.16904007, -0.28683385, -0.17815922, -1.3796724, 0.12043695, -1.0539042, 0.088524215,
+    -0.11078133, -0.09492969, -0.12509587, -0.09770823, 0.19268005, 0.21728607, -0.13797577, 0.16290097,
+    -0.08777351, 0.20019534, 0.2965593, 0.79357064, 0.74057144, 0.80109465, 0.36189824, 0.42882514,
+    -0.11263481, -0.10128948, -0.26326802, 0.23707487, 0.44490448, 0.20519029, 0.85375947, 0.9718963,
+    0.849976, 0.4026578, 0.51985025, -0.093257956, -0.18815236, -0.186766, 0.5408358, 0.5678829,
+    0.5983793, 0.37550798, 0.8493428, 0.33620107, 0.21626984, -0.12664428, -0.11536118, 0.25085205,
+    0.36021245, -0.22710103, -0.2831592, 0.2796542, 0.33034414, -0.28158268, 0.27499327, -0.0964516,
+    -0.26439357, -0.21195628, -0.4657918, -0.7752089, -0.2587634, -0.2272102, -0.56440383, -0.40888095,
+    0.19369477, -0.4650696, -0.31137115, -0.5062032, -0.83879685, -0.3335873, -0.9076783, -0.12448862,
+    0.3120966, -0.08738594, 0.2783775, -0.0868788, -0.21688375, -0.14164129, -0.08407702, 0.097810045,
+    -0.2553659, 0.14820716, -0.32591322, 0.4168305, 0.22358634, 0.19340324, 0.18540354, -0.23470756,
+    -0.28157744, -0.29812387, -0.23996097, -0.3291774, -0.3428065, -0.39655042, 0.14578229, -0.09020014,
+    -0.2757581, 0.16137119, 0.5019106, 0.27430984, 0.27061734, 0.33021498, 0.21381788, -0.42114195,
+    -0.45516527, -0.14056526, -0.1353766, -0.09957175, 0.094817765, 0.17521417, 0.29422015, -0.23043779,
+    -0.5395518, 0.31343856, -0.11439959, -0.15161806, -0.15303086, 0.25213102, 0.2698285, -0.12303081,
+    -0.18730389, -0.18227962, -0.095590614, -0.08587848, 0.124614984, 0.14585185, 0.16415815, 0.12699701,
+    0.26154196, 0.1933989, -0.19766374, -0.9631226, -0.87017965, -0.38067335, -1.0370225, -1.4138718,
+    -0.57152325, -0.53859955, -0.13753279, 0.21958393, 0.29611164, -0.33719742, -0.6032932, 0.2724269,
+    0.55381775, 0.29715893, 0.4593714, 0.32038286, 0.5019114, 0.5400318, 0.16882706, 0.35640198,
+    0.15886483, -0.123060875, 0.48371843, 0.64104867, 0.149335, 0.40917963, 0.20323756, -0.13358147,
+    0.7644858, 0.90791756, 0.3921588, 0.42637512, 0.22659677, -0.35293248, -0.3614525, -0.10329567,
+    -0.40742403, 0.16577272, -0.36332306, -0.62380207, 0.70531553, 0.3427056, -0.20479013, -0.55830586,
+    -0.5207988, -0.57754314, -0.26847965, -0.40863317, -0.17103209, -0.93979937, -0.4606165, 0.21805958,
+    0.10783121, 0.100455925, -0.12911223, -0.16774958, -0.45203668, -0.5896757, -0.49398425, -0.12683791,
+    -0.7841545, -0.68133235, 0.12836286, -0.51138544, -0.6755543, -0.516615, 0.14148712, -0.57356817,
+    -0.17818731, -0.27176824, -0.33272585, -0.7875773, -0.789811, -0.17242096, 0.48668557, -0.23818333,
+    0.123687536, -0.28249454, 0.10707198, -0.6107132, -0.83948517, -0.17642182, 0.09571259, 0.11516477,
+    0.55183524, -0.43624324, -0.21522418, -0.12400367, 0.17739731, -1.2506253, -0.2381756, 0.13996452,
+    -0.45579055, -0.1714586, -0.3376058, 0.3864234, -0.16456077, -0.09150786, -0.69186527, -0.33497342,
+    0.220366, -1.6903365, -0.51310074, 0.10069368, -0.46574363, 0.5443714, -0.34051725, -0.19314508,
+    0.2302751, 0.14040662, -0.51053447, -0.4801085, -1.5363928, -0.5488055, 0.21156472, 0.19682825,
+    0.098001376, 0.4578507, 0.6328384, 0.25566664, 0.27358326, -0.4526596, 0.6180083, -0.5074129,
+    0.4768311, 0.1614487, -0.4435022, 1.4671522, 0.46626094, 0.28978345, 0.15195385, 0.12218554,
+    0.14397839, 0.24477969, 0.3124041, 0.19063927, 0.14676009, -0.08982722, -0.09934352, -0.08951398,
+    -0.083430745, -0.10115702, -0.57093936, -0.65800446, 1.3247399, -0.6257647, -0.65103394, -0.7873688,
+    -0.6634034, 0.11360041, -1.0502328, 0.6325417, 1.4688486, -1.9522072, -0.26409087, -1.0166297,
+    -0.7489529, 0.5051472, 1.1519806, -2.0898924, -0.38864076, 0.38113034, 0.3231147, 0.22003494,
+    0.37262437, 0.24757956, 0.75339305, -0.43776655, 0.19790559, -0.32106513, -0.8200606, -0.6023122,
+    -0.2527012, 0.10110566, 0.46618354, 0.61329854, 0.5730986, 0.31858677, 0.3091565, -0.25205478,
+    -2.9062006, -0.7362217, -0.5710697, -0.41357997, -0.1549654, -0.14064915, 0.28615704, 0.14709118,
+    0.59512275, 0.37899756, 0.18820652, 0.6482063, -0.6977201, -1.2239057, 0.16856432, -0.8086561,
+    -0.45934123, -0.13281195, -0.22374584, -0.26860267, -0.11811274, 0.44785708, 1.317229, 0.19885996,
+    -0.570879, -0.44445673, -0.53047734, -0.35931116, -0.21347617, -0.17324135, -0.094303004, -0.24780454,
+    -0.5071581, -0.47023758, 0.6721054, 0.87438637, -0.4915027, -0.7558724, 0.48301256, 0.0974866,
+    0.18388936, -0.10067117, 0.08429655, 0.10524919, -0.22103713, -1.0322872, -0.7086445, -0.4327301,
+    -0.27941486, 0.44814956, -0.57185876, -0.30331922, 0.4117518, -0.57556456, -0.13539508, 0.26844567,
+    -0.3158026, -0.61307997, -0.28719535, -0.99463683, 0.14224945, -0.75618553, -0.8491836, -0.22531967,
+    0.21232031, 0.14385992, -0.4972214, 0.12963614, 0.11932231, 0.15507288, -0.51373506, -0.5115416,
+    -0.35933354, -2.1263878, -1.060634, -1.118497, 0.44495353, 0.3864762, -0.33676937, -0.2008235,
+    -0.2376465, 0.14066787, -0.4275119, -0.6582884, -0.14208166, -0.50672877, -1.4057735, -0.16083446,
+    0.21502411, 0.36483124, 0.11772213, 0.08953211, 0.09679117, 0.2392058, 1.0641485, -0.6458344,
+    0.2722893, -0.3069263, -0.10381505, 0.2984434, 0.1389085, 0.23758577, 0.2578925, 0.26606447,
+    0.27209115, -0.102301694, 1.0597956, 0.20805575, -0.5590124, -1.0311364, 0.31775114, -0.19611026,
+    0.28556684, -0.17920172, 0.6004899, 0.53713346, -0.16634299, 1.2146252, 1.9556754, -0.6230041,
+    -0.085451916, -0.09798402, -0.08691875, -0.1691553, -0.3706546, -0.22175914, 0.09730515, 0.3280891,
+    0.08767618, -0.10445002, -0.13006462, -0.084451385, -0.08339409, -0.19361183, -0.24943666, -0.18008605,
+    0.08730174, 0.20909014, 0.18778777, -0.090584874, -0.4136678, -0.60134083, -0.21108939, -0.2800644,
+    -0.35397005, -0.10173499, -0.13464297, -0.11132122, -0.14421684, -0.19221824, -0.120026976, -0.27553043,
+    -0.12420191, -0.43117508, -0.10382829, -0.67183816, -0.47327927, -0.49584278, -0.29972005, -0.279053,
+    0.109734006, -0.3528292, -0.6116731, -0.15800019, -0.5965051, -0.32515478, -0.34535685, -0.21448074,
+    -0.33329532, -0.4124605, -0.11051284, -0.169745, -0.087676354, -0.26795554, -0.3302031, -0.7246488,
+    0.23876725, 0.4591048, 0.6689498, 0.68152624, 0.5518777, -0.10017154, -0.098310255, -0.2451668,
+    -0.09014647, -0.5744322, -0.9070662, 0.5128317, 0.562394, 0.46790817, 0.28965977, 0.19066197,
+    1.0083123, 0.4659965, -0.14678359, -0.42163762, -0.3296145, 0.23400071, 0.43778947, 0.658038,
+    0.39301613, 0.14674826, -0.17195594, 0.65536225, 0.54353625, 0.7315141, 0.29694942, -0.092142686,
+    0.2911629, 0.26621562, 0.3710591, 0.3501839, -0.11158599, 0.14471832, 0.65684885, 0.63306564,
+    0.47716638, 0.5723136, 0.38809764, -0.12220724, -0.13179229, 0.16668394, 0.23371208, 0.46511835,
+    0.20951937, 0.25400034, -0.13747382, -0.10444218, -0.08734803, 0.08526143, -0.3260593, 0.12943663,
+    -0.30740532, 0.114054434, -0.11065829, -0.085712194, -0.19526196, -0.13128799, -0.36666003, -0.37412143,
+    -0.35566315, -0.38841283, -0.5055529, -0.66358835, -0.6602388, 0.09752893, 0.65482825, -0.51402485,
+    -0.4363231, -0.31240577, -0.1591227, -0.26811433, 0.12830189, -0.58880055, -0.20204785, -0.35275868,
+    0.10254545, -0.30515727, 0.09531534, -0.5119302, -0.5682955, 0.3052506, -0.16262208, -0.5642036,
+    -0.62317276, 0.1593188, -0.50979376, 0.11224033, -0.21784393, -0.17211531, -0.23181175, -0.5225617,
+    -0.09046123, 0.4172711, -0.0935479, -0.7112212, -0.29219, -0.3887769, -0.13489866, 0.24065414,
+    -0.2349077, 0.38723606, -0.14941369, -1.0107756, 0.34725088, -0.24064972, 0.100236, 0.15010998,
+    0.24560398, 0.28360125, 0.22035259, -0.1895608, 0.3446438, 0.53681827, -0.1636256, -0.26090902,
+    -0.94747627, -0.3696629, 0.26549602, 0.2893673, 0.53631824, 0.52207696, 0.6160691, 0.5984675,
+    0.30313313, 0.2349366, 0.10646613, -0.16351917, -0.53189737, -1.7320472, 0.69849664, -0.083688766,
+    0.1568569, 0.75539964, 0.65873975, 0.511542, 0.56245846, 0.69179404, 0.69128865, 0.4280478,
+    -0.14806242, -1.0948572, 0.7079759, 0.8473973, 0.40239227, 0.3810043, 0.5006465, 0.40108246,
+    0.4106897, 0.32109582, 0.43573004, -0.34130242, -0.15505578, 1.0526898, 0.72178406, 0.5314629,
+    0.404127, 0.3029516, 0.13812946, 0.4772775, 0.2106724, 0.20528558, 0.23005569, 0.2315628,
+    -0.20373216, -0.14089152, -0.39920324, 1.0783709, 0.31298205, 0.3689403, 0.33898705, 0.30053884,
+    0.19302431, 0.14600497, -0.27598912, -0.12890238, 0.9072212, -0.16199362, 0.7798822, 0.67200357,
+    0.58068204, 0.10025574, 0.3245862, -0.09474377, -0.43830404, 0.1303487, 0.09810595, -0.12870361,
+    0.7700019, 0.5086556, 0.1525731, 0.18179892, -0.17746085, -0.9184409, -0.688609, -0.3755666,
+    -1.1906302, -0.6158783, -0.1627967, -0.26792, -0.36120245, 0.090960905, -0.9176605, 0.9178535,
+    0.43546304, 0.35336798, -0.8085942, -0.8835791, -1.1464604, -0.914982, -0.31056768, -0.10590034,
+    0.11477529, -0.2611061, -0.10746102, -0.12408234, -0.09793715, -0.5603422, -1.535266, 0.24610585,
+    -0.7702831, 1.3646898, -0.39498714, 1.7013952, 0.2503062, 1.4989737, 0.5166554, 0.20045859,
+    -0.22262795, -0.70886266, -2.038644, -0.9711583, -0.29771605, -0.1695397, -0.70552677, -0.47892267,
+    -0.12221064, 0.31936404, -0.81786186, -1.5075477, -0.41327152, -1.1017663, 0.52744585, -0.13392167,
+    0.1794353, 0.12136666, 0.10595577, 0.24151874, 0.5486816, -0.31741473, 0.35037804, 0.14617229,
+    -1.2823185, -0.90500915, -0.42241508, -0.7638604, 0.5537758, -0.45867115, 0.10633051, 0.2557748,
+    0.16294518, 0.11107883, 0.51534677, 0.657969, -0.1440104, 1.2657571, -2.4902213, -0.9115881,
+    -0.15916446, -0.31109038, -0.24265578, -0.32369646, 0.17690195, -0.7393557, -1.4578967, 0.1364402,
+    -0.21199267, -0.13446656, 0.80606204, -0.50521713, -0.55909157, -0.46465886, 0.37324882, 0.1149068,
+    -0.23072101, -0.39775074, 0.11438251, 0.18668365, 0.088560365, -1.3062958, 0.21449277, -0.42670003,
+    -0.97349626, 0.412909, -0.16445869, 0.23167641, -0.20417038, -1.0481547, -0.49226257, -0.44156063,
+    -0.6049831, -0.29663467, 0.27588007, -0.23709507, 0.26819775, 0.25481758, -0.19930944, 0.10135493,
+    -0.5339921, 0.08782852, -0.14132169, -0.5828864, -0.43515673, -0.244033, 0.39603788, 0.32840815,
+    -0.1373315, 0.7850167, 0.63762444, 0.4352654, 0.4111502, -0.6330918, -0.13229868, 0.24164079,
+    -0.18780768, 0.0984493, 0.35137063, 0.31267032, 0.18115725, 0.3960415, 0.6241283, -0.4847371,
+    -0.90104276, 0.14715795, -0.17488764, 0.21563928, 0.11002334, 0.37594277, 0.34050706, 0.49147025,
+    -0.84589154, -0.12601383, -1.6615554, -1.493381, -0.12524694, 0.18621555, -0.22842994, -0.17897397,
+    0.39001197, -0.21034431, -0.6440026, -2.7072554, -0.114963874, -0.10643743, -0.26464292, -0.91001695,
+    -0.36278662, -0.44624582, -1.0649508, -0.42889544, -0.2988865, -0.22783323, -0.14946868, -0.2264685,
+    0.2278398, -0.091520034, 0.099228844, 0.14384574, 0.25901648, -0.20172201, -0.16375312, 0.172287,
+    0.16900302, -0.18885809, -0.2810433, 0.14750822, 0.2560106, 0.3661751, -0.15518723, -0.1233409,
+    -0.10673098, -0.13747956, 0.33813277, 0.27631888, 0.55085474, 0.66482264, 0.7541519, 0.130008,
+    0.17169476, -0.13067439, -0.18266082, 0.7828396, 0.17793733, 0.22245468, 0.15802836, 0.5030218,
+    0.13126898, -0.23755644, -0.31179136, -0.1554913, 0.73005056, 0.3620149, 0.7533348, 0.6483217,
+    0.5610757, 0.14265148, 0.09497503, 0.20958854, -0.4170172, -0.7297051, 0.8499971, 0.36858612,
+    0.17497937, 0.14440566, -0.23109798, 0.12007054, -0.7567767, -1.4644005, -0.50401306, 0.5534386,
+    0.52926373, 0.749038, 0.13033101, 0.3455898, -0.37819052, 0.1825237, -0.21468395, -0.26559535,
+    -1.3171152, -1.1187866, 0.2072213, -0.40542898, 0.15663375, -0.24067304, -0.6835167, -0.75800693,
+    -1.3222132, -1.0440015, -0.26929665, 0.17019036, -0.2407539, -0.13255957, 0.20797575, 0.13522148,
+    -0.8713425, -0.99762, -0.6184075, -0.76666343, -1.0855687, 0.29226938, 0.17833476, 0.3225521,
+    -0.11335056, 0.13822703, 0.09131192, 0.15898433, -0.5364278, -0.40258786, 0.16328928, -0.6166242,
+    0.18578343, 0.0941325, 0.1588873, 0.0925855, 0.24794893, 0.39623073, 0.22707674, -0.28514302,
+    -0.31161264, 0.09237065, 0.0991294, 0.5568397, 0.8317972, 0.16343927, 0.32835382, 1.0122377,
+    0.105955146, 1.0277641, 1.0087035, -0.10912039, 0.43080392, 0.45934954, 1.3354855, 0.2667126,
+    -0.24078344, -0.16159423, -0.22810929, -0.2501782, -0.13304839, 0.35514218, -0.22131744, 0.1035847,
+    0.6036556, 0.74882364, -0.49547115, -0.5361425, -0.9782632, -0.5537227, -0.2975453, -0.47549996,
+    -0.14601538, -0.16692926, 0.112121135, 0.53022945, -1.0616735, -0.32611614, -1.1976715, -0.7920157,
+    -0.90476984, -0.97382236, -0.3531185, -1.2123055, -0.3626064, -0.16247696, 0.2803571, -0.9066793,
+    -0.44450548, -1.2006289, -0.5325497, -0.48610097, 0.39890623, 0.09627718, 0.42682955, 0.4935748,
+    -0.31788218, -0.65335697, -0.70059645, -1.8159525, -0.45993823, -0.81640095, -0.7415528, 0.8552735,
+    0.504264, 0.4345059, 0.4243952, 0.41630018, -0.22383139, -0.6566881, -0.46382257, -1.157614,
+    -1.2433594, -0.39311436, 0.645464, 0.8150637, 0.20830166, 0.31629676, 0.31716037, 0.6226772,
+    0.23493639, -0.1149838, -1.9083664, -0.377061, -0.40344417, -1.138819, -0.25677624, 0.3662063,
+    0.3839878, 0.27412271, 0.65652037, -0.1295618, -0.8384329, 0.2076024, -1.2950628, -0.24266933,
+    -0.7182309, -0.5858609, -0.13056435, 0.643484, 0.6428617, -0.29923445, -0.61124414, 0.3319577,
+    -0.16857165, -0.2507299, -1.3855861, -0.3968492, -0.117129706, -0.29933277, 0.32192025, -0.66316354,
+    -0.09825501, -0.1702711, -1.7484052, -0.49775913, -0.17337252, 0.48028737, 0.23050506, 0.26279432,
+    -0.31369093, -0.59239715, 0.32537404, 0.1126953, -0.51612985, -0.7805594, 0.74403405, 0.3504119,
+    -0.5071271, -0.37325698, 0.32999957, 0.5609159, -0.5476033, 0.23616837, 0.4706104, 0.865255,
+    -0.23272902, 0.85819006, -0.18774962, 0.0918438, -0.49262354, 0.095580585, 0.08449589, 0.09324421,
+    0.09589471, 0.085230306, -0.22893454, -0.24032736, -0.23648313, -0.34369174, -0.32205316, -0.3331824,
+    -0.32314306, -0.73052996, -0.6700503, -0.30388567, -0.38818914, -0.31646055, -0.32401744, -0.24229369,
+    -0.24634233, -0.4048226, -0.60864866, -1.117012, -1.7707671, -2.2864828, -0.19084917, 0.9681847,
+    -0.9954965, -1.1613876, -1.680875, -1.4165413, -0.89386857, -0.2755304, -0.21547061, -0.8400806,
+    0.539136, 0.124528706, 0.15671864, 0.21976775, 0.2916548, -0.18873607, -0.34186083, -0.37891373,
+    -0.8445528, 0.85731447, -1.9998052, -1.9128848, 0.62149566, 0.65983355, -0.6994547, -0.21320134,
+    -0.28691992, -0.08599696, -0.1872026, -0.27540368, 0.17522934, -2.2132473, 0.27025717, -0.5507894,
+    -0.47364506, 0.2902355, -0.14805071, 0.2775261, 0.14236522, -0.12576523, -0.20724547, 0.19007528,
+    1.3157564, 0.95456624, 0.08581763, 0.24833709, -0.10142558, 0.15510534, 0.092710175, -0.6057592,
+    0.95340496, 0.29935488, 0.85562485, 0.13562419, -0.15311205, 0.18831798, 0.75435644, -0.7882386,
+    -0.6877973, -0.36407405, -0.5145272, -0.3377966, 0.29806817, 0.16385, 0.259743, 0.58779913,
+    -0.6093147, -0.41142595, -0.19767043, 0.6860515, 0.24718106, 0.26595107, -0.6134279, -1.3291011,
+    -0.124617346, 0.21659774, 0.36356544, -0.35124373, 0.28702876, 0.25489953, -0.45663074, -0.6638109,
+    0.3177374, 0.42433918, 0.33993554, -0.532222, 0.44035858, 0.8062751, -0.14596213, -0.42132157,
+    0.100330085, -0.23471472, -0.5445242, -0.6896635, -0.14122371, 0.26981416, -0.29007393, -0.3426509,
+    -0.81424236, -0.2763309, 0.8777483, -0.25407422, -0.20700675, 0.19703166, -0.25965178, -0.2013107,
+    -0.42009738, -0.38433778, -0.26324475, -0.42380536, -0.7462017, 1.1209909, -0.380386, -0.12262491,
+    0.5321659, 0.083981566, -0.21551959, -0.33537686, -0.5673023, -0.32788906, -0.21081655, -0.24749693,
+    -0.52219933, -2.002221, -0.25577486, 1.3763986, 0.59931374, 0.19647515, 0.19020163, 0.29795507,
+    0.1748884, 0.1685766, -0.24730913, 0.27041334, -0.6629791, -0.691747, -0.26119485, 0.08397467,
+    -0.18975945, -0.100455016, -0.17379257, -0.15564647, -0.58355516, -0.22480346, 0.34364542, -0.23532365,
+    -0.3742483, -0.27338594, -0.40428525, -0.24725442, -0.7856842, -0.39261162, -0.17174722, -0.09005293,
+    0.13319337, -0.5557615, -0.39880022, -0.3380792, -0.40909413, -0.18629798, -0.34630013, -0.2362655,
+    0.5577304, -0.17288926, 0.17566556, -0.15410778, -0.3930444, 0.13092163, 0.3945804, 0.119589254,
+    0.2128498, 0.14534782, -0.12210228, 0.30337292, 0.14722659, 0.44422343, 0.53114706, -0.22404933,
+    -0.59139574, -0.3646668, -0.18502733, 0.1248118, 0.24330547, 1.0073879, 1.2796525, 0.7218653,
+    0.56218404, 0.15125291, -0.4216522, -0.59596753, -0.46405807, -0.15554322, -0.23170853, 0.54233164,
+    0.56469905, 0.5864583, 0.8016507, 0.45270535, 0.10191218, 0.11819297, 0.39331025, -0.102157116,
+    0.44756782, 0.70065695, 0.19145286, -0.12565957, -0.15785189, -0.3106577, 0.11325885, -0.16062006,
+    0.18433353, 0.33904734, 0.40486643, -0.5063671, -0.20892723, -0.20174472, 0.10442047, 0.20418918,
+    0.20375118, -0.107077554, -0.20863907, -0.33175725, -0.16187859, 0.08921555, -0.10659312, 0.19992347,
+    0.20102249, -0.19965452, -0.25521323, 0.2807201, 0.2849394, 0.1208337, -0.09711738, -0.19413544,
+    -0.18309578, 0.18087588, 0.28933617, 0.28883126, 0.35125375, 0.29424798, 0.271642, 0.19147506,
+    0.1161208, 0.13633403, 0.23608397, 0.30263975, 0.34753016, 0.2931064, 0.32759884, 0.09652676,
+    0.33673313, 0.17803627, -0.93913615, -0.5545118, -0.40137193, -0.9883324, -1.1656324, -0.4067524,
+    0.29260746, 0.27787504, 0.38816363, 0.15471554, -0.11042676, 0.2645353, 0.2090571, -0.8237374,
+    0.1491627, 0.16312344, 0.43982053, 0.15682524, 0.5005123, 0.5168459, 0.34267673, 0.12995306,
+    0.29337195, 0.12996496, 0.40383214, -0.3888122, 0.15606393, 0.20963801, 0.74912465, -0.09123239,
+    0.79878217, 0.51200134, 0.2649018, -0.08401776, -0.17618209, 0.12839206, -0.36320078, 0.17489149,
+    0.5575707, 0.40759623, 0.8347538, 0.49597806, -0.3917905, -0.17769969, -0.69401425, -0.10646678,
+    -0.2164361, -0.26175147, -0.6346031, -0.14486888, 0.106679365, 1.3804914, 1.0569681, 0.08995038,
+    -0.20149034, 0.242938, -0.8435004, -0.7230301, -0.24900936, 0.5719113, -0.5724527, -0.46402377,
+    -0.10757676, -0.5085482, -0.16697137, -0.11018701, -0.3375898, -0.15932843, 0.083477214, 0.6862196,
+    -0.56192183, -0.7852279, -0.46420184, -0.11301815, 0.18832307, -0.19051719, -0.4177201, -0.17504069,
+    0.32842362, 0.08596342, 0.5438479, -0.9928679, -0.40452522, -0.22658576, -0.6177272, -0.96828896,
+    -0.7976254, -0.17873362, 0.5254491, -1.0158167, 0.10800498, 0.3121432, -0.74093527, -0.29631642,
+    -0.2835209, -0.70335156, -0.14746815, -0.42505357, -0.50706005, -0.5892165, -0.59842044, -1.1633917,
+    0.20612153, 0.096665174, 0.52693045, 0.25062627, -0.65353227, -1.6394287, -1.5228995, -0.19216359,
+    -0.11774576, -0.79724294, -0.8500948, 0.31859368, 0.13323611, 0.48013327, 0.28824723, -1.2798506,
+    -1.2579046, -2.1974154, -0.49877515, -0.104345076, -0.51644355, 0.3669746, -0.27109933, 0.2603818,
+    0.29424122, 0.097014256, 0.0835737, 0.10419402, 0.15364389, -0.12465185, 0.18638037, 0.20135918,
+    0.08868205, -0.47787347, -0.5487136, -0.15053245, -0.60899407, -0.84070855, -1.1655722, -0.46791086,
+    -0.632257, -0.1304611, -0.20707949, -0.23903425, -3.8545043, 0.55284506, 0.4959111, 0.14770812,
+    0.38270465, 0.23845798, -0.16232546, 0.9200393, -0.18678845, -1.5814234, -0.6217344, 0.37334117,
+    0.18457589, 0.20107847, 0.25145993, -0.13621682, 0.4022884, 0.44615135, -0.28189358, 0.9141594,
+    -0.2931253, 0.12020666, 0.10405139, -0.09267438, 0.1369119, 0.12192665, 0.3123763, 0.15010814,
+    -0.35885265, -0.14459893, 0.19651057, -0.6874114, 1.0037898, -0.3697722, -0.47295186, 0.17032743,
+    0.19779554, 0.14589673, 0.43153328, -0.4204954, -0.19598848, -1.2722007, -0.7541986, 0.4843439,
+    -0.2448457, -0.35735425, -0.14316821, 0.31549963, 0.32247138, 0.42195344, -0.22566713, -0.091473974,
+    -0.6920744, -0.28481075, -0.26903507, -0.14103748, -0.31665432, -0.09723368, 0.12776925, 0.17022054,
+    0.22306272, 0.19216122, 0.22310103, 0.39905843, 0.10738652, -0.52685285, -1.7115047, 0.37859195,
+    -0.46754086, 0.20821054, -0.08942456, -0.26066577, -0.1655515, -0.23194414, -0.2943391, 0.32727134,
+    -0.11663416, -0.13468, 0.11568765, -0.19688441, 0.12810361, 0.14651361, -0.12450515, -0.46212623,
+    -0.24002363, -0.65349185, 0.52691966, 0.31063157, -0.24167575, 0.09844801, -0.3374926, -0.18973827,
+    -0.11325177, 0.17749523, 0.11143416, 0.2285622, -0.32344517, -0.17257862, -0.9961291, -0.13943505,
+    -0.4260691, 0.31394896, -0.30080038, 0.12161258, 0.2325753, -0.12094061, -0.2793235, 0.32955995,
+    -0.6593502, -1.0277635, 0.31633884, -0.15874201, 0.1391694, -0.3530033, -0.15675664, 0.20058806,
+    0.29055122, 0.30499938, 0.32326648, 0.16198422, 0.67590034, -0.28239232, -2.2861006, -0.37586698,
+    -0.762852, -0.21918859, -0.15035112, 0.264216, -1.5060948, -0.61707276, 0.16450252, 0.23378426,
+    0.36978877, 0.28778425, 0.24063893, 0.08965443, 0.21481688, -0.09409489, 0.17300846, 0.40925172,
+    0.402571, 0.36951238, 0.31367835, 0.14431971, 0.2979276, 0.2986088, 0.15537634, -0.13662839,
+    0.18547013, 0.21542458, -0.29528874, 0.17309803, 0.0927463, 0.345721, 0.18240389, 0.11481157,
+    -0.36532444, -0.55181944, -0.18379337, 0.13674255, -0.1650084, -0.10832496, -0.24104822, -0.37703288,
+    -0.55928755, -0.52311456, -0.60039556, -0.49909532, 0.08877188, 0.20769037, 0.085432634, -0.7247467,
+    -0.5421129, -0.469166, -0.4056468, -0.44143882, 0.18483889, 0.16685507, -0.24068226, 0.16363628,
+    0.13360931, -0.32871866, -0.2212078, -0.43343043, 0.17603475, -0.5318001, -0.37925565, -0.23224409,
+    0.09926678, 0.43674493, 0.10957228, -0.28404996, -0.35850587, -0.38098696, -0.4102623, -0.27374944,
+    0.10647713, -0.18767765, -0.122699164, 0.14795725, -0.42121494, -0.18346624, 0.5016038, 0.2858717,
+    0.28268522, 0.1252464, -0.09940354, -0.13154264, -0.6278447, -1.0670102, -0.54231983, -0.56153125,
+    0.18253262, 0.4221314, 0.08419857, -0.16259925, -0.62315077, -0.84356713, -0.8404896, -0.62218624,
+    0.09208291, 0.31686327, -0.12939832, -0.09224187, 0.119649924, -0.24115482, 0.08960401, -0.2504928,
+    0.12458337, 0.29439062, 0.08396708, 0.18059078, 0.19246528, 0.1916457, 0.12688068, -0.096758425,
+    -0.09466348, -0.31335098, 0.12820706, 0.14952482, -0.3359984, 0.42399687, -0.4405003, 0.2141103,
+    0.26520255, 0.23889366, -0.2636838, -0.1998159, 0.29151967, -0.25639102, 0.15195481, -0.16183628,
+    -0.16358277, 0.10984537, 0.11434003, 0.23493174, 0.23895708, -0.22129375, 0.1508124, 0.29784772,
+    -0.39609647, -0.6345821, -0.3342745, 0.14647561, 0.1469971, 0.21560594, 0.3835116, 0.3185495,
+    -1.1768113, -0.13230318, 0.28269365, 0.16201605, 0.42253762, -0.14806576, 0.24148618, 0.10762876,
+    0.14479789, 0.59232616, -0.14062822, -0.35933226, -0.2560823, 0.21933277, 0.42174068, 0.34085056,
+    -0.19821258, -0.09960202, 0.30839056, -0.43188873, -0.9859263, 0.4750016, 0.17390232, 0.25268552,
+    0.34468073, -0.22303484, 0.11074463, -0.33914408, -0.36532548, -0.42974055, -0.4462162, 0.20632976,
+    -1.0950611, 0.29163355, -0.2730395, 0.29040214, 0.13824488, -0.1375789, 0.2261368, 0.44106284,
+    0.21948044, -0.1482634, 0.14568272, -0.31189185, -0.60795933, -0.33518478, 0.10798032, -0.40309328,
+    0.24725513, 0.35552886, 0.27407083, 0.44405922, -0.35778108, -0.41588372, 0.13262413, -0.8840744,
+    -0.5727576, -0.43392837, -0.650945, 0.3424673, -0.19848497, -0.5264349, 0.2078748, -1.0218736,
+    -0.41505402, -0.4673885, 0.10318851, -0.09394463, 0.2911387, -0.4996136, -0.2958202, -1.4379315,
+    0.27459848, 0.42008108, 0.19927958, -0.30817482, -0.44143218, -0.95637625, 0.08510572, 0.12638475,
+    -0.15749033, 0.12541465, 1.3495927, -0.11901402, -0.113325424, -0.6225763, 0.08383365, -0.20443603,
+    -0.66737676, 0.19475271, 0.14741749, -0.10764127, 0.8084227, 0.9962451, 0.9526131, 0.6447381,
+    0.74055254, 0.94459134, 0.88921165, -0.67821825, -0.811084, 0.21552593, 0.72645557, 0.28547814,
+    0.96095407, 0.7120196, 0.815018, 0.97308606, 0.2124477, 0.23546255, -2.502783, -0.28058425,
+    -0.86640173, -0.9566574, 0.74015576, -2.3081558, -2.7691526, 0.08975703, 0.42734462, 0.8588194,
+    0.21669537, -0.3895247, -4.4938045, 0.41876277, 0.7739769, 0.50048447, 0.1827664, 0.406178,
+    -0.1873635, -0.4730081, -0.2484112, -0.61207175, 0.55886376, -1.5529302, -1.3739231, -0.5808789,
+    0.26584497, 0.53357023, 0.23924826, 0.083229885, 0.09047922, -0.5223033, -0.6483978, -1.0601457,
+    0.16869491, -3.3045878, 0.4802906, 0.16725199, 0.12235471, 0.20238163, 0.23181932, 0.18780091,
+    -0.31322604, -0.5368408, 0.22321412, -1.0170467, 0.19291897, -0.1323963, 0.18408331, 0.43442848,
+    0.4771875, -0.19545926, -0.3490242, -0.22994816, -0.3369896, -0.43230787, -0.39964256, 0.7287862,
+    0.68125075, -0.29495966, -0.12074892, -0.08720567, 0.69328403, 0.36277872, -0.16656126, -0.08587155,
+    -0.22942509, -1.2192007, -0.46280506, -0.16547064, -0.22619517, 0.14738522, -0.4294958, 0.15236238,
+    0.5346348, 0.17336899, 0.32576594, -0.3816223, -0.27827668, -1.0273589, -0.25859773, 0.5286457,
+    -0.9693144, -0.67410636, 0.18518333, 0.12731653, 0.14777574, 0.17665294, -0.3882567, 0.40673125,
+    -1.7194136, -0.6537505, -0.8966948, -0.5868289, -0.7336353, 0.08765656, 0.46793282, -0.09189959,
+    -0.45955226, -0.21438529, -0.36847404, -0.16878189, -0.3798142, 0.7926611, 0.4237527, -1.1160927,
+    0.3688238, -0.53237635, -0.09066079, -0.22664648, -0.4124702, -0.117407076, -0.31938884, -0.2752208,
+    0.28535613, -1.0510364, 0.3117962, -2.2150211, -0.08474104, -0.36504272, -0.23094364, -0.12427117,
+    -0.32043174, -0.22070685, -0.45617118, 0.4613769, -0.8115965, 0.87179583, 0.88631356, -0.21277465,
+    0.10935427, 0.26699603, 0.4043959, -0.13498385, -0.77656937, 0.81223494, 0.08883243, 0.25952768,
+    0.13099924, -0.13740233, -0.31516597, -0.1273017, 0.21966593, 0.47890422, 0.45110664, 0.2598869,
+    0.46697378, 0.37906298, -0.4205534, -0.318324, -0.2740682, -0.10491934, 0.098094255, 0.23956163,
+    -0.16593839, 0.10055462, -0.23481716, 0.1093756, -0.6556967, -0.18249007, -0.35888237, -0.2540557,
+    0.08376076, 0.39981502, -0.13571425, -0.49360856, -0.61287284, -0.8161103, 0.3057732, -0.26396185,
+    -0.27889612, -0.23712113, 0.12651436, 0.26316932, -0.6703776, -0.50526625, -0.8652974, -1.129537,
+    -0.4180207, -0.59052014, -0.19758192, 0.22349009, 0.14328693, 0.083613664, -0.6605175, -0.6413169,
+    -0.6459668, -0.5148654, -0.14912042, -1.0601213, -0.5371939, 0.3638969, -0.10165126, -0.14825375,
+    -0.4405377, -0.65664786, -0.1228092, -0.35831466, -0.30375755, -0.23111898, 0.09654445, -0.2220871,
+    0.142419, -0.12836559, 0.2925123, 0.1518631, -0.50051606, -0.5286352, 0.40224463, 0.7654343,
+    0.5615604, 0.3931925, -0.2730999, 0.08557446, 0.1869044, 0.32139343, 0.62448287, 0.68212044,
+    0.21410032, 0.27068594, -0.086513214, -0.18602993, -0.33592772, 0.43287352, 0.26235786, 0.17762372,
+    -0.119800165, 0.18993933, 0.10376159, 0.09129151, 0.25436115, 0.1323261, -0.1561726, -0.16872649,
+    0.08362778, 0.09120901, 0.0948437, -0.13464138, 0.1353989, 0.11411057, 0.12983367, -0.10997438,
+    -1.0648687, -0.2027685, 0.3671726, 0.2965791, -0.2913137, 0.16977009, -0.103866816, -0.35602012,
+    0.08481897, 0.084585525, -0.8715541, -0.49848795, 0.42505237, -0.3861614, -0.11933787, 0.09324147,
+    0.21002996, -0.11091538, -0.17448573, 0.34234273, -0.08955269, -0.5376596, -0.2691488, 0.1323542,
+    -0.29797322, -0.682007, -0.12859988, 0.18184793, 0.34740975, 0.16984503, 0.36380085, 0.40933844,
+    0.35435608, -0.5411898, -0.69187146, -0.39780343, -0.6599816, -0.5138408, 0.303005, 0.35766602,
+    0.28170875, 0.18991782, -0.41640845, -0.48894632, -0.4800241, -0.31886977, -0.124845326, -0.46208885,
+    0.18979748, 0.5146508, 0.20125301, 0.37659618, -0.2287719, -0.4725139, -0.63379747, 0.19957587,
+    0.1606886, 0.12620576, -0.52542055, -0.20769031, -0.1746025, -0.11545406, -0.2212389, -0.37328154,
+    -0.18886761, -0.7643288, -0.08358085, -0.16831264, 0.27828076, 0.37657383, -0.43951052, -0.32761592,
+    -0.3224756, -0.55784094, -0.3898718, -0.45254964, -1.3547839, -0.7342139, 0.48910448, 0.085501745,
+    0.35017416, 0.22452803, 0.14301643, -1.0547093, -0.91825026, -0.12724003, -0.4979307, -0.31995144,
+    -0.56718534, -0.59962815, 0.5883578, 0.23198572, -0.77124923, -0.64279014, -0.31531554, 0.20184061,
+    0.49697122, 0.23076986, -0.4693724, 0.51624084, 0.24814953, 0.19717865, 0.08665484, 0.19418997,
+    -0.38678256, -0.65993553, -0.32119584, 0.30541104, -0.62315965, 0.4441513, 0.81502247, -0.15413716,
+    -0.12536581, 0.38325953, -0.3374871, 0.47072408, 0.11242016, 0.43865365, 0.83015, 0.10691536,
+    0.29931852, 0.61860603, -0.6258898, -1.1202242, -0.93466496, 0.2782256, -0.29311365, 0.48024884,
+    -0.08351072, -0.15230945, -0.16742092, 0.09604414
+};
+
+#endif // CONVNET_SPARSE_WEIGHTS_H
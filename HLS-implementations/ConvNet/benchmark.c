@@ -0,0 +1,40 @@
+#include "ConvNet.h"
+#include "ConvNet_host.h"
+#include "../host/benchmark.h"
+
+// Host-only speed benchmark of the ConvNet forward pass (see ../host/benchmark.h for the options)
+// Build it like the testbench, with benchmark.c in place of testbench.c.
+
+// Floating-point operations of one forward pass: a multiply and an add per MAC of the 3x3
+// convolution and of the fully connected layer (ReLU and pooling comparisons are not counted)
+#define CONVNET_FLOPS (2.0 * (INPUT_HEIGHT * INPUT_WIDTH * CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 3 * 3 + \
+                              FC1_INPUT_SIZE * NUM_CLASSES))
+
+int main(int argc, char **argv) {
+    BenchmarkConfig config;
+    if (benchmark_parse_args(argc, argv, &config) != 0) {
+        return 1;
+    }
+
+    BenchmarkTarget target = {
+        .network = "convnet",
+        .sample_floats = INPUT_HEIGHT * INPUT_WIDTH * INPUT_CHANNELS,
+        .input_min = -1.0f,          // range of the normalized MNIST pixels
+        .input_max = 1.0f,
+        .flops_per_sample = CONVNET_FLOPS,
+        .kernels = {
+            {"reference", convnet_classify_image, CONVNET_SCRATCH_SIZE},
+            {"simd", convnet_classify_image_simd, CONVNET_SCRATCH_SIZE},
+            {"winograd", convnet_classify_image_winograd, CONVNET_SCRATCH_SIZE},
+            {"batch", NULL, CONVNET_BATCH_SCRATCH_SIZE, convnet_classify_batch, CONVNET_BATCH_MAX_IMAGES},
+            {"dispatch", NULL, CONVNET_BATCH_SCRATCH_SIZE, convnet_classify_dispatch, CONVNET_DISPATCH_MAX_IMAGES}
+        },
+        .num_kernels = 5
+    };
+    int status = benchmark_run(&target, &config);
+#ifdef CONVNET_PROFILE
+    // Per-stage breakdown of the reference kernel (the SIMD kernels are not instrumented)
+    convnet_profile_print(stderr);
+#endif
+    return status;
+}
@@ -1,108 +1,433 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+#include <string.h>
 #include "ConvNet.h"
+#include "ConvNet_host.h"
+#include "CNN.h"
+#include "../host/dataset_reader.h"
+#include "../host/dispatcher.h"
+#include "../host/inference_pool.h"
+#include "../host/simd_kernels.h"
 
 #define INPUT_FILE_PATH "./input_image.txt"
-#define IMAGE_SIZE (INPUT_HEIGHT * INPUT_WIDTH) // Size of the input image
+#define WEIGHTS_PATH "./convnet_weights.bin"
+#define IMAGE_SIZE (INPUT_HEIGHT * INPUT_WIDTH * INPUT_CHANNELS) // Size of the input image
+#define BATCH_SIZE 64                           // Images per batch of the dataset reader and of the worker pool
+#define DISPATCH_UNITS 2                        // Host dispatcher units per model
+#define WINOGRAD_TOLERANCE 1e-4f                // Max class score error of the Winograd convolution
+#define SPARSE_TOLERANCE 1e-4f                  // Max class score error between the HLS and host sparse FC layers
+#define NUM_PRUNE_RATIOS 7                      // Pruning ratios of the sparse accuracy report
 
+_Static_assert(BATCH_SIZE <= CONVNET_DISPATCH_MAX_IMAGES, "forward_dispatch() takes at most CONVNET_DISPATCH_MAX_IMAGES images");
+_Static_assert(CNN_OUTPUTS == NUM_CLASSES && CNN_input_SIZE == IMAGE_SIZE, "CNN_model.h must describe the ConvNet");
+_Static_assert(sizeof(CNN) == sizeof(ConvNet), "CNN_model.h must have the weights layout of ConvNet");
 
+// FC layer pruned at each ratio of the report, and at the ratio of the tables of forward_sparse()
+static const double prune_ratios[NUM_PRUNE_RATIOS] = {0.0, 0.1, 0.2, 0.3, 0.5, 0.7, 0.9};
+static SparseLayer pruned_fc1[NUM_PRUNE_RATIOS];
+static SparseLayer exported_fc1;
 
-void read_input_image(const char *file_path, float input[INPUT_HEIGHT][INPUT_WIDTH][1], int *label) {
-    FILE *file = fopen(file_path, "r");
-    if (file == NULL) {
-        perror("Failed to open input file");
-        exit(EXIT_FAILURE);
+// Row source for forward_rows(): copies the rows of an image already in memory
+void image_row_source(int h, float row[INPUT_WIDTH][INPUT_CHANNELS], void *ctx) {
+    float (*image)[INPUT_WIDTH][INPUT_CHANNELS] = ctx;
+    for (int w = 0; w < INPUT_WIDTH; w++) {
+        for (int c = 0; c < INPUT_CHANNELS; c++) {
+            row[w][c] = image[h][w][c];
+        }
     }
+}
+
+// Runs all the checks of the testbench on one image
+// Returns 0 if they pass, 1 otherwise.
+static int check_image(float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS], int label) {
+    float output[NUM_CLASSES];
 
-    // read the label
-    if (fscanf(file, "Label: %d\n", label) != 1) {
-        perror("Failed to read label");
-        fclose(file);
-        exit(EXIT_FAILURE);
+    int results = forward(input, output);
+
+    if (results != 0) {
+        printf("Error during forward pass\n");
+        return 1;
     }
 
-    // read image data
-    for (int h = 0; h < INPUT_HEIGHT; h++) {
-        // read opening brace
-        char c;
-        while ((c = fgetc(file)) != EOF && (c == ' ' || c == '\n')); // skip spaces and newlines
-        if (c != '{') {
-            perror("Failed to read opening brace");
-            fclose(file);
-            exit(EXIT_FAILURE);
+    // The row-fed forward pass must give exactly the same class scores
+    float rows_output[NUM_CLASSES];
+    forward_rows(image_row_source, input, rows_output);
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        if (rows_output[i] != output[i]) {
+            printf("forward_rows() differs from forward() on class %d\n", i);
+            return 1;
         }
+    }
 
-        // read image values
-        for (int w = 0; w < INPUT_WIDTH; w++) {
-            if (fscanf(file, "%f", &input[h][w][0]) != 1) {
-                printf("Failed to read image value at (%d, %d)\n", h, w);
-                fclose(file);
-                exit(EXIT_FAILURE);
-            }
+    printf("Predicted output:\n");
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        printf("Class %d: %f\n", i, output[i]);
+    }
 
-            // read comma if not last value
-            if (w < INPUT_WIDTH - 1) {
-                if (fscanf(file, ",") != 0) {
-                    perror("Failed to read comma between values");
-                    fclose(file);
-                    exit(EXIT_FAILURE);
-                }
-            }
+    // The predicted label comes from the kernel's top-k stage, no scan of the scores on the host
+    ClassScore top[CONVNET_TOP_K];
+    forward_topk(input, -INFINITY, top);
+    int predicted_label = top[0].label;
+    printf("Predicted label: %d\n", predicted_label);
+    printf("True label: %d\n", label);
+
+    // The top-k must hold the k best scores of forward(), in decreasing order
+    for (int i = 0; i < CONVNET_TOP_K; i++) {
+        int rank = 0;
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            rank += output[c] > output[top[i].label] || (output[c] == output[top[i].label] && c < top[i].label);
+        }
+        printf("Top %d: class %d (%f)\n", i + 1, top[i].label, top[i].score);
+        if (rank != i || top[i].score != output[top[i].label]) {
+            printf("forward_topk() entry %d does not match forward()\n", i);
+            return 1;
         }
+    }
+
+    // With a threshold between the first and second scores only the best class is returned
+    float threshold = CONVNET_TOP_K > 1 ? (top[0].score + top[1].score) / 2 : top[0].score;
+    ClassScore thresholded[CONVNET_TOP_K];
+    if (forward_topk(input, threshold, thresholded) != 1 || thresholded[0].label != predicted_label ||
+        forward_topk(input, top[0].score + 1.0f, thresholded) != 0) {
+        printf("forward_topk() does not apply the confidence threshold\n");
+        return 1;
+    }
+
+    // The layered CNN engine runs the same network from its model descriptor
+    float cnn_output[NUM_CLASSES];
+    static float cnn_workspace[CNN_WORKSPACE_SIZE];
+    int cnn_label = cnn_forward((const CNN *)convnet_params, &input[0][0][0], cnn_workspace, cnn_output);
+    printf("Layered CNN predicted label: %d\n", cnn_label);
+#if CNN_FC_ACCUMULATORS == FC_ACCUMULATORS
+    // Same accumulation order as forward(): the class scores must be identical
+    if (cnn_label != predicted_label || memcmp(cnn_output, output, sizeof(output)) != 0) {
+#else
+    if (cnn_label != predicted_label) {
+#endif
+        printf("Layered CNN and forward() differ\n");
+        return 1;
+    }
 
-        // read closing brace
-        while ((c = fgetc(file)) != EOF && (c == ' ' || c == '\n' || c == ',')); // skip spaces, newlines and commas
-        if (c != '}') {
-            perror("Failed to read closing brace");
-            fclose(file);
-            exit(EXIT_FAILURE);
+    // The Winograd convolution only changes the rounding of the class scores
+    float winograd_output[NUM_CLASSES];
+    forward_winograd(input, winograd_output);
+    float winograd_error = 0.0f;
+    int winograd_label = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        if (fabsf(winograd_output[i] - output[i]) > winograd_error) {
+            winograd_error = fabsf(winograd_output[i] - output[i]);
+        }
+        if (winograd_output[i] > winograd_output[winograd_label]) {
+            winograd_label = i;
+        }
+    }
+    printf("Winograd predicted label: %d (max class score error: %g)\n", winograd_label, winograd_error);
+    if (winograd_label != predicted_label || winograd_error > WINOGRAD_TOLERANCE) {
+        printf("Winograd and direct convolutions differ\n");
+        return 1;
+    }
+
+    // The sparse FC top function must follow the host sparse kernel on the same pruned weights,
+    // up to the order of the additions of its accumulators
+    float sparse_output[NUM_CLASSES];
+    float host_sparse_output[NUM_CLASSES];
+    if (forward_sparse(input, sparse_output) != 0) {
+        printf("forward_sparse() rejects the weights its tables were pruned from\n");
+        return 1;
+    }
+    int host_sparse_label = convnet_forward_sparse(input, &exported_fc1, host_sparse_output);
+    float sparse_error = 0.0f;
+    int sparse_label = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        if (fabsf(sparse_output[i] - host_sparse_output[i]) > sparse_error) {
+            sparse_error = fabsf(sparse_output[i] - host_sparse_output[i]);
+        }
+        if (sparse_output[i] > sparse_output[sparse_label]) {
+            sparse_label = i;
         }
+    }
+    printf("Sparse FC (ratio %g) predicted label: %d (max class score error vs host: %g)\n",
+           convnet_sparse_ratio, sparse_label, sparse_error);
+    if (sparse_label != host_sparse_label || sparse_error > SPARSE_TOLERANCE) {
+        printf("forward_sparse() and the host sparse kernel differ\n");
+        return 1;
+    }
 
-        // read the comma if not last row
-        if (h < INPUT_HEIGHT - 1) {
-            if (fscanf(file, ",") != 0) {
-                perror("Failed to read comma between rows");
-                fclose(file);
-                exit(EXIT_FAILURE);
+    // The vectorized CPU kernels must give the same prediction at every supported SIMD level
+    for (int level = simd_detect(); level >= SIMD_SCALAR; level--) {
+        float simd_output[NUM_CLASSES];
+        simd_set_level((SimdLevel)level);
+        convnet_forward_simd(input, simd_output);
+
+        float max_error = 0.0f;
+        int simd_label = 0;
+        for (int i = 0; i < NUM_CLASSES; i++) {
+            if (fabsf(simd_output[i] - output[i]) > max_error) {
+                max_error = fabsf(simd_output[i] - output[i]);
+            }
+            if (simd_output[i] > simd_output[simd_label]) {
+                simd_label = i;
             }
         }
+        printf("SIMD (%s) predicted label: %d (max class score error: %g)\n", simd_level_name(level), simd_label, max_error);
+        if (simd_label != predicted_label) {
+            printf("SIMD and reference predictions differ\n");
+            return 1;
+        }
+    }
+    simd_set_level(simd_detect());
+
+    // Run the quantized path on the same image and compare it with the float one
+    float quantized_output[NUM_CLASSES];
+    forward_quantized(input, quantized_output);
+
+    float max_error = 0.0f;
+    int quantized_label = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        float error = fabsf(quantized_output[i] - output[i]);
+        if (error > max_error) {
+            max_error = error;
+        }
+        if (quantized_output[i] > quantized_output[quantized_label]) {
+            quantized_label = i;
+        }
+    }
+    printf("Quantized predicted label: %d (max class score error: %f)\n", quantized_label, max_error);
+    if (quantized_label != predicted_label) {
+        printf("Quantized and float predictions differ\n");
+        return 1;
+    }
+
+    // The exported binary weights must give the same class scores, both memory-mapped on the host
+    // and loaded through the reloadable-weights top function
+    if (convnet_map_weights(WEIGHTS_PATH) != 0) {
+        return 1;
+    }
+    float mapped_output[NUM_CLASSES];
+    float reloaded_output[NUM_CLASSES];
+    forward(input, mapped_output);
+    forward_weights((const float *)convnet_params, 1, input, reloaded_output);
+    convnet_unmap_weights();
+    if (memcmp(mapped_output, output, sizeof(output)) != 0 || memcmp(reloaded_output, output, sizeof(output)) != 0) {
+        printf("Binary weights and compiled-in weights give different class scores\n");
+        return 1;
+    }
+    printf("Binary weights class scores match\n");
+
+    // The Winograd convolution must follow reloaded weights and the sparse FC, whose pruned weights
+    // are compiled in, must refuse them: swap the first two filters and the first two classes,
+    // then restore the original weights
+    static ConvNet original, swapped;
+    original = *convnet_params;
+    swapped = original;
+    memcpy(swapped.conv1.weights[0], original.conv1.weights[1], sizeof(original.conv1.weights[0]));
+    memcpy(swapped.conv1.weights[1], original.conv1.weights[0], sizeof(original.conv1.weights[0]));
+    memcpy(swapped.fc1.weights[0], original.fc1.weights[1], sizeof(original.fc1.weights[0]));
+    memcpy(swapped.fc1.weights[1], original.fc1.weights[0], sizeof(original.fc1.weights[0]));
+    forward_weights((const float *)&swapped, 1, input, reloaded_output);
+    forward_winograd(input, winograd_output);
+    int stale_sparse = forward_sparse(input, sparse_output);
+    forward_weights((const float *)&original, 1, input, mapped_output);
+    if (stale_sparse != -1 || forward_sparse(input, sparse_output) != 0) {
+        printf("forward_sparse() does not check its tables against the weights in use\n");
+        return 1;
+    }
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        if (fabsf(winograd_output[i] - reloaded_output[i]) > WINOGRAD_TOLERANCE) {
+            printf("The Winograd convolution does not follow reloaded weights\n");
+            return 1;
+        }
+    }
+    if (memcmp(reloaded_output, output, sizeof(output)) == 0 || memcmp(mapped_output, output, sizeof(output)) != 0) {
+        printf("Reloading the weights does not change the class scores\n");
+        return 1;
     }
+    printf("Winograd class scores follow reloaded weights, the sparse FC refuses them\n");
 
-    fclose(file);
+    return 0;
 }
 
+// Classifies a batch with forward(), forward_batch(), forward_dispatch(), the host worker pool
+// and the host dispatcher, which must all agree, and with the FC layer pruned at each ratio of the
+// report (correct predictions and agreements with forward() counted per ratio)
+// Returns 0 if they do, 1 otherwise.
+static int classify_batch(const DatasetBatch *batch, InferencePool *pool, Dispatcher *dispatcher,
+                          long *correct, long *pool_correct, long pruned_correct[NUM_PRUNE_RATIOS],
+                          long pruned_agreements[NUM_PRUNE_RATIOS]) {
+    float (*images)[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS] = (float (*)[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS])batch->samples;
+    int predictions[BATCH_SIZE];
+    float scratch[NUM_CLASSES];
+    float batch_scores[BATCH_SIZE][NUM_CLASSES];
+    float dispatch_scores[BATCH_SIZE][NUM_CLASSES];
 
-int main() {
-    float input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS];
-    float output[NUM_CLASSES];
-    int label;
+    // Serve the batch through the host dispatcher, alternating between the reference and the SIMD model
+    for (int n = 0; n < batch->count; n++) {
+        dispatcher_submit(dispatcher, n % 2, images[n]);
+    }
+    // Push the whole batch through the ping-pong buffered top function
+    if (forward_batch(batch->samples, batch->count, &batch_scores[0][0]) != 0 ||
+        forward_batch(batch->samples, CONVNET_BATCH_MAX_IMAGES + 1, &batch_scores[0][0]) != -1) {
+        printf("forward_batch() does not check the batch size\n");
+        return 1;
+    }
+    if (forward_dispatch(batch->samples, batch->count, &dispatch_scores[0][0]) != 0 ||
+        forward_dispatch(batch->samples, CONVNET_DISPATCH_MAX_IMAGES + 1, &dispatch_scores[0][0]) != -1) {
+        printf("forward_dispatch() does not check the batch size\n");
+        return 1;
+    }
 
-    read_input_image(INPUT_FILE_PATH, input, &label);
+    InferenceBatch pool_batch = {
+        .samples = batch->samples,
+        .sample_size = sizeof(images[0]),
+        .count = batch->count,
+        .labels = batch->labels,
+        .predictions = predictions
+    };
+    *pool_correct += inference_pool_run(pool, &pool_batch);
 
-    int results = forward(input, output);
+    for (int n = 0; n < batch->count; n++) {
+        int prediction = convnet_classify_image(images[n], scratch);
+        if (prediction == batch->labels[n]) {
+            (*correct)++;
+        }
+        if (predictions[n] != prediction) {
+            printf("Worker pool prediction differs on image %ld\n", batch->first + n);
+            return 1;
+        }
+        if (memcmp(batch_scores[n], scratch, sizeof(scratch)) != 0) {
+            printf("forward_batch() class scores differ on image %ld\n", batch->first + n);
+            return 1;
+        }
+        if (memcmp(dispatch_scores[n], scratch, sizeof(scratch)) != 0) {
+            printf("forward_dispatch() class scores differ on image %ld\n", batch->first + n);
+            return 1;
+        }
+        for (int r = 0; r < NUM_PRUNE_RATIOS; r++) {
+            float sparse_output[NUM_CLASSES];
+            int sparse_prediction = convnet_forward_sparse(images[n], &pruned_fc1[r], sparse_output);
+            pruned_correct[r] += sparse_prediction == batch->labels[n];
+            pruned_agreements[r] += sparse_prediction == prediction;
+        }
+    }
 
-    if (results != 0) {
-        printf("Error during forward pass\n");
+    // The dispatcher results must come back in submission order with the same predictions
+    long sequence;
+    int prediction;
+    for (int n = 0; dispatcher_result(dispatcher, &sequence, &prediction) == 0; n++) {
+        if (sequence != batch->first + n || prediction != predictions[n]) {
+            printf("Dispatcher result %ld out of order or wrong for image %ld\n", sequence, batch->first + n);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    // input_image.txt by default, or a file with any number of images in the same format
+    const char *path = argc > 1 ? argv[1] : INPUT_FILE_PATH;
+#ifdef CONVNET_EXTERNAL_WEIGHTS
+    // no weights compiled in: load them before the first forward pass, as the host of the FPGA would
+    if (convnet_load_weights(WEIGHTS_PATH) != 0) {
         return 1;
     }
+#endif
 
-    printf("Predicted output:\n");
-    for (int i = 0; i < NUM_CLASSES; i++) {
-        printf("Class %d: %f\n", i, output[i]);
+    // The images are parsed in the background while the previous batches are classified
+    DatasetReader *reader = dataset_open(path, DATASET_IMAGES, IMAGE_SIZE, 0, BATCH_SIZE);
+    if (!reader) {
+        return 1;
+    }
+    InferencePool *pool = inference_pool_create(0, convnet_classify_image, CONVNET_SCRATCH_SIZE);
+    DispatcherModel models[] = {
+        {convnet_classify_image, DISPATCH_UNITS, CONVNET_SCRATCH_SIZE},
+        {convnet_classify_image_simd, DISPATCH_UNITS, CONVNET_SCRATCH_SIZE}
+    };
+    Dispatcher *dispatcher = dispatcher_create(models, 2, BATCH_SIZE);
+    if (!pool || !dispatcher) {
+        inference_pool_destroy(pool);
+        dispatcher_destroy(dispatcher);
+        dataset_close(reader);
+        return 1;
     }
 
-     // Find the class with the highest probability
-    float max_prob = output[0];
-    int predicted_label = 0;
-    
-    for (int i = 1; i < NUM_CLASSES; i++) {
-        if (output[i] > max_prob) {
-            max_prob = output[i];
-            predicted_label = i;
+    for (int r = 0; r < NUM_PRUNE_RATIOS; r++) {
+        if (convnet_prune(prune_ratios[r], &pruned_fc1[r]) != 0) {
+            return 1;
         }
     }
-    printf("Predicted label: %d\n", predicted_label);
-    printf("True label: %d\n", label);
+    if (convnet_prune(convnet_sparse_ratio, &exported_fc1) != 0) {
+        return 1;
+    }
 
+    long images = 0;
+    long correct = 0;
+    long pool_correct = 0;
+    long pruned_correct[NUM_PRUNE_RATIOS] = {0};
+    long pruned_agreements[NUM_PRUNE_RATIOS] = {0};
+    int failed = 0;
+    const DatasetBatch *batch;
+    while (!failed && (batch = dataset_next(reader)) != NULL) {
+        // The first image also goes through the detailed checks
+        if (batch->first == 0) {
+            failed = check_image((float (*)[INPUT_WIDTH][INPUT_CHANNELS])batch->samples, batch->labels[0]);
+        }
+        if (!failed) {
+            failed = classify_batch(batch, pool, dispatcher, &correct, &pool_correct, pruned_correct, pruned_agreements);
+            images += batch->count;
+        }
+        dataset_release(reader, batch);
+    }
+    failed |= dataset_failed(reader);
+    int threads = inference_pool_threads(pool);
+    long unit_requests[2][DISPATCH_UNITS];
+    for (int m = 0; m < 2; m++) {
+        for (int u = 0; u < DISPATCH_UNITS; u++) {
+            unit_requests[m][u] = dispatcher_unit_requests(dispatcher, m, u);
+        }
+    }
+    inference_pool_destroy(pool);
+    dispatcher_destroy(dispatcher);
+    dataset_close(reader);
+    if (failed || images == 0) {
+        return 1;
+    }
+
+    printf("Accuracy: %ld/%ld images (%.2f%%)\n", correct, images, 100.0 * correct / images);
+    printf("Worker pool (%d threads): %ld/%ld correct\n", threads, pool_correct, images);
+    printf("forward_batch class scores match\n");
+    printf("forward_dispatch (%d units) class scores match\n", CONVNET_DISPATCH_UNITS);
+    printf("Dispatcher results in order, requests per unit: reference %ld/%ld, simd %ld/%ld\n",
+           unit_requests[0][0], unit_requests[0][1], unit_requests[1][0], unit_requests[1][1]);
+
+    // Accuracy of the magnitude-pruned FC layer against the share of its weights (and MACs) kept
+    printf("FC pruning ratio vs accuracy:\n");
+    printf("%6s %12s %9s %9s\n", "ratio", "weights", "accuracy", "agrees");
+    for (int r = 0; r < NUM_PRUNE_RATIOS; r++) {
+        printf("%5.0f%% %5d/%-6d %8.2f%% %8.2f%%\n", prune_ratios[r] * 100, pruned_fc1[r].nnz,
+               pruned_fc1[r].rows * pruned_fc1[r].cols, 100.0 * pruned_correct[r] / images,
+               100.0 * pruned_agreements[r] / images);
+        sparse_layer_free(&pruned_fc1[r]);
+    }
+
+#ifdef CONVNET_PROFILE
+    // Every image run through a stage must have counted that stage's MACs
+    LayerCounters counters[CONVNET_PROFILE_STAGES];
+    convnet_profile_read(counters);
+    convnet_profile_print(stdout);
+    // Stages in the order of CONVNET_PROFILE_STAGE_NAMES; every image goes through one of the two
+    // convolutions and one of the two FC layers. Stalls are only counted on the FPGA.
+    const LayerCounters *conv = &counters[0], *wconv = &counters[1], *pooling = &counters[2], *fc = &counters[3];
+    const LayerCounters *sfc = &counters[4];
+    if (conv->macs != conv->calls * INPUT_HEIGHT * INPUT_WIDTH * CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 9 ||
+        wconv->macs != wconv->calls * (INPUT_HEIGHT / 2) * (INPUT_WIDTH / 2) * CONV1_OUTPUT_CHANNELS * INPUT_CHANNELS * 16 ||
+        fc->macs != fc->calls * FC1_INPUT_SIZE * NUM_CLASSES || sfc->macs != sfc->calls * exported_fc1.nnz ||
+        pooling->calls != conv->calls + wconv->calls || fc->calls + sfc->calls != pooling->calls ||
+        conv->stall_cycles + wconv->stall_cycles + pooling->stall_cycles + fc->stall_cycles + sfc->stall_cycles != 0) {
+        printf("Profiling counters are inconsistent\n");
+        return 1;
+    }
+#endif
+    sparse_layer_free(&exported_fc1);
     return 0;
 }
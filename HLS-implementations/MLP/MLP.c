@@ -1,4 +1,5 @@
 #include "MLP.h"
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -7,92 +8,636 @@ float reLu(float x) {
     return x > 0 ? x : 0;
 }
 
+// Softmax over n values, in place
+static void softmax(float *x, int n) {
+    #pragma HLS INLINE
+    float max = x[0];
+    for (int i = 1; i < n; i++) {
+        if (x[i] > max) {
+            max = x[i];
+        }
+    }
+    float sum = 0;
+    for (int i = 0; i < n; i++) {
+        x[i] = expf(x[i] - max);
+        sum += x[i];
+    }
+    for (int i = 0; i < n; i++) {
+        x[i] /= sum;
+    }
+}
+
+// Network weights of the iris model
+// Build with -DMLP_EXTERNAL_WEIGHTS to leave out the tables below and load them at run time
+// (mlp_map_weights() on the host, forward_batch_weights() on the FPGA). Models given with
+// -DMLP_MODEL always load their weights this way.
+#if !defined(MLP_EXTERNAL_WEIGHTS) && !defined(MLP_MODEL)
 MLP mlp = {
-    .num_layers = 3,
-    .layers = {
-        // fc1
-        {
-            .weights = {
-                {0.099288, -0.452716, 0.957605, 0.517334},
-                {0.220560, -0.666361, 0.772435, 0.389321},
-                {0.957434, 0.931137, -0.088062, -0.886874},
-                {0.171310, -0.261900, -0.481757, -0.173231},
-                {-0.329190, -0.124102, 0.428382, -0.030107},
-                {0.181957, -0.538837, 0.682200, 0.713888},
-                {0.144945, 0.507604, -0.269793, -0.199517},
-                {-0.075747, 0.202625, -0.398569, -0.076711},
-                {0.101007, -0.398583, -0.366854, -0.304911},
-                {-0.525624, -0.124397, 0.663196, 1.085638}
-            },
-            .biases = {-0.780636, -0.114756, 1.137292, 0.116033, -0.233900, -0.257343, 0.012394, -0.086546, -0.312638, -0.667115}
+    // fc1
+    .fc1 = {
+        .weights = {
+            {0.099288, -0.452716, 0.957605, 0.517334},
+            {0.220560, -0.666361, 0.772435, 0.389321},
+            {0.957434, 0.931137, -0.088062, -0.886874},
+            {0.171310, -0.261900, -0.481757, -0.173231},
+            {-0.329190, -0.124102, 0.428382, -0.030107},
+            {0.181957, -0.538837, 0.682200, 0.713888},
+            {0.144945, 0.507604, -0.269793, -0.199517},
+            {-0.075747, 0.202625, -0.398569, -0.076711},
+            {0.101007, -0.398583, -0.366854, -0.304911},
+            {-0.525624, -0.124397, 0.663196, 1.085638}
         },
-        // fc2
-        {
-            .weights = {
-                {-0.435560, -0.538333, 0.253035, 0.120499, 0.098796, 0.016922, 0.362046, -0.070930, 0.207683, -0.152756},
-                {-0.295931, 0.123051, -0.294462, 0.027270, 0.159673, -0.088673, 0.124290, 0.177104, -0.037433, -0.142208},
-                {-0.299856, 0.042192, -0.052551, 0.167064, -0.207485, 0.039520, -0.288037, 0.087825, -0.047375, -0.220476},
-                {0.228607, 0.308247, -0.321292, -0.028800, -0.093888, 0.400650, 0.039870, -0.184433, 0.010677, 0.760814},
-                {0.051853, -0.047708, -0.241395, 0.217187, 0.014528, -0.315055, -0.225099, 0.089136, -0.281209, -0.110815},
-                {0.730003, 0.647504, -0.068370, 0.202805, -0.028918, 0.331941, -0.374136, -0.101397, -0.074116, 0.472928},
-                {-0.591532, -0.205189, 0.809988, -0.033138, 0.190923, -0.071424, 0.048885, 0.272477, -0.167278, -0.746578},
-                {0.086213, -0.317306, -0.151554, 0.234929, 0.126355, -0.012326, 0.094182, -0.186780, 0.060410, -0.014026},
-                {0.712435, 0.435129, 0.125985, 0.231775, 0.269586, 0.848233, -0.540500, -0.059259, 0.241100, 0.581109},
-                {-0.498703, -0.301602, 0.832068, -0.029463, -0.160015, -0.421864, 0.481599, 0.196709, 0.155504, -0.502033}
-            },
-            .biases = {0.391001, -0.102510, 0.112756, -0.503014, 0.308852, -0.300739, 0.549250, -0.227250, 0.216680, 0.251347}
+        .biases = {-0.780636, -0.114756, 1.137292, 0.116033, -0.233900, -0.257343, 0.012394, -0.086546, -0.312638, -0.667115}
+    },
+    // fc2
+    .fc2 = {
+        .weights = {
+            {-0.435560, -0.538333, 0.253035, 0.120499, 0.098796, 0.016922, 0.362046, -0.070930, 0.207683, -0.152756},
+            {-0.295931, 0.123051, -0.294462, 0.027270, 0.159673, -0.088673, 0.124290, 0.177104, -0.037433, -0.142208},
+            {-0.299856, 0.042192, -0.052551, 0.167064, -0.207485, 0.039520, -0.288037, 0.087825, -0.047375, -0.220476},
+            {0.228607, 0.308247, -0.321292, -0.028800, -0.093888, 0.400650, 0.039870, -0.184433, 0.010677, 0.760814},
+            {0.051853, -0.047708, -0.241395, 0.217187, 0.014528, -0.315055, -0.225099, 0.089136, -0.281209, -0.110815},
+            {0.730003, 0.647504, -0.068370, 0.202805, -0.028918, 0.331941, -0.374136, -0.101397, -0.074116, 0.472928},
+            {-0.591532, -0.205189, 0.809988, -0.033138, 0.190923, -0.071424, 0.048885, 0.272477, -0.167278, -0.746578},
+            {0.086213, -0.317306, -0.151554, 0.234929, 0.126355, -0.012326, 0.094182, -0.186780, 0.060410, -0.014026},
+            {0.712435, 0.435129, 0.125985, 0.231775, 0.269586, 0.848233, -0.540500, -0.059259, 0.241100, 0.581109},
+            {-0.498703, -0.301602, 0.832068, -0.029463, -0.160015, -0.421864, 0.481599, 0.196709, 0.155504, -0.502033}
         },
-        // fc3
-        {
-            .weights = {
-                {0.723252, -0.216710, -0.209677, -0.236799, 0.125862, -0.505804, 0.557877, 0.228974, -0.673829, 0.511271},
-                {-0.780301, 0.307417, 0.099260, -0.792102, -0.230814, 0.036830, 0.645035, -0.187485, 0.132777, 0.106330},
-                {-0.166297, 0.061751, 0.221582, 0.440270, -0.070659, 0.727096, -0.954511, 0.135507, 0.253526, -0.723126}
-            },
-            .biases = {-0.052471, 0.534004, -0.171671}
-        }
+        .biases = {0.391001, -0.102510, 0.112756, -0.503014, 0.308852, -0.300739, 0.549250, -0.227250, 0.216680, 0.251347}
+    },
+    // fc3
+    .fc3 = {
+        .weights = {
+            {0.723252, -0.216710, -0.209677, -0.236799, 0.125862, -0.505804, 0.557877, 0.228974, -0.673829, 0.511271},
+            {-0.780301, 0.307417, 0.099260, -0.792102, -0.230814, 0.036830, 0.645035, -0.187485, 0.132777, 0.106330},
+            {-0.166297, 0.061751, 0.221582, 0.440270, -0.070659, 0.727096, -0.954511, 0.135507, 0.253526, -0.723126}
+        },
+        .biases = {-0.052471, 0.534004, -0.171671}
     }
 };
+#else
+MLP mlp;
+#endif
 
-int forward(float input0, float input1, float input2, float input3) {
-    const int input_sizes[4] = {4, 10, 10, 3};
-    const int num_layers = 3;
+#ifdef __SYNTHESIS__
+#define MLP_PARAMS mlp
+#else
+// On the host the kernels read the weights through mlp_params, so they can also run directly
+// on a memory-mapped weights file
+const MLP *mlp_params = &mlp;
+#define MLP_PARAMS (*mlp_params)
+#endif
+
+// Opt-in layer profiling (-DMLP_PROFILE), compiled out otherwise
+// Each layer has its own counters, updated once per sample.
+#ifdef MLP_PROFILE
+#define MLP_LAYER_COUNTERS(name, source, n_in, n_out, activation) static LayerCounters profile_##name;
+MLP_LAYERS(MLP_LAYER_COUNTERS)
+#ifdef __SYNTHESIS__
+// On the FPGA all the layers are stages of the one sample pipeline, so they cannot be timed one by
+// one: forward_batch_profiled() times the whole sample loop instead
+#define PROFILE_ADD(layer, field, n) (profile_##layer.field += (n))
+#define PROFILE_START(layer)
+#define PROFILE_STOP(layer)
+#else
+#include "../host/profile_clock.h"
+// On the host the layers can run on several worker threads at once
+#define PROFILE_ADD(layer, field, n) __atomic_fetch_add(&profile_##layer.field, (n), __ATOMIC_RELAXED)
+#define PROFILE_START(layer) uint64_t profile_start_##layer = profile_clock()
+#define PROFILE_STOP(layer) PROFILE_ADD(layer, time, profile_clock() - profile_start_##layer)
+#endif
+#else
+#define PROFILE_ADD(layer, field, n)
+#define PROFILE_START(layer)
+#define PROFILE_STOP(layer)
+#endif
+
+// Emits an HLS pragma from a macro, with the macro arguments expanded
+#define MLP_PRAGMA(text) _Pragma(#text)
+
+// Generates <layer>_forward(): a dense layer with the weights of params, followed by its activation.
+// The trip counts are compile-time constants, so HLS can fully unroll each layer.
+#define MLP_LAYER_KERNEL(name, source, n_in, n_out, activation)                                 \
+    static void name##_forward(const MLP *params, const float in[n_in], float out[n_out]) {     \
+        _Pragma("HLS INLINE")                                                                   \
+        PROFILE_START(name);                                                                    \
+        for (int j = 0; j < n_out; j++) {                                                       \
+            float sum = params->name.biases[j];                                                 \
+            for (int k = 0; k < n_in; k++) {                                                    \
+                sum += params->name.weights[j][k] * in[k];                                      \
+            }                                                                                   \
+            out[j] = (activation) == MLP_ACT_RELU ? reLu(sum) : sum;                            \
+        }                                                                                       \
+        if ((activation) == MLP_ACT_SOFTMAX) {                                                  \
+            softmax(out, n_out);                                                                \
+        }                                                                                       \
+        PROFILE_STOP(name);                                                                     \
+        PROFILE_ADD(name, macs, (n_in) * (n_out));                                              \
+        PROFILE_ADD(name, calls, 1);                                                            \
+    }
 
-    float current_input[MAX_NEURONS];
-    float next_input[MAX_NEURONS];
+MLP_LAYERS(MLP_LAYER_KERNEL)
 
-    current_input[0] = input0;
-    current_input[1] = input1;
-    current_input[2] = input2;
-    current_input[3] = input3;
+// Output buffer of a layer, kept in registers
+#define MLP_LAYER_BUFFER(name, source, n_in, n_out, activation) \
+    float act_##name[n_out];                                    \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=act_##name complete)
 
-    for (int i = 0; i < num_layers; i++) {
+// Runs a layer on the output of its source, which must have n_in values
+#define MLP_LAYER_CALL(name, source, n_in, n_out, activation)                           \
+    _Static_assert(sizeof(act_##source) == (n_in) * sizeof(float),                      \
+                   #name ": n_in does not match the width of " #source);                \
+    name##_forward(params, act_##source, act_##name);
+
+#define MLP_ACTIVATIONS(name) MLP_ACTIVATIONS_(name)
+#define MLP_ACTIVATIONS_(name) act_##name
+
+// Runs one sample through all the layers of the descriptor, with the weights of params, and stores
+// the output layer in scores
+static void run_layers(const MLP *params, const float input[MLP_INPUTS], float scores[MLP_OUTPUTS]) {
+    #pragma HLS INLINE
+    float act_input[MLP_INPUTS];
+    #pragma HLS ARRAY_PARTITION variable=act_input complete
+    for (int f = 0; f < MLP_INPUTS; f++) {
+        act_input[f] = input[f];
+    }
+    MLP_LAYERS(MLP_LAYER_BUFFER)
+    MLP_LAYERS(MLP_LAYER_CALL)
+
+    const float *output = MLP_ACTIVATIONS(MLP_OUTPUT_LAYER);
+    for (int i = 0; i < MLP_OUTPUTS; i++) {
         #pragma HLS UNROLL
-        Layer *layer = &mlp.layers[i];
-        for (int j = 0; j < input_sizes[i + 1]; j++) {
-            float sum = layer->biases[j];
-            
-            for (int k = 0; k < input_sizes[i]; k++) {
+        scores[i] = output[i];
+    }
+}
 
-                sum += layer->weights[j][k] * current_input[k];
-            }
-            next_input[j] = reLu(sum);
+// Runs one sample through the network with the weights of params, stores the output layer in
+// scores and returns the predicted class (the highest score).
+static int classify(const MLP *params, const float input[MLP_INPUTS], float scores[MLP_OUTPUTS]) {
+    #pragma HLS INLINE
+    run_layers(params, input, scores);
+
+    int max_index = 0;
+    for (int i = 0; i < MLP_OUTPUTS; i++) {
+        #pragma HLS UNROLL
+        if (scores[i] > scores[max_index]) {
+            max_index = i;
         }
+    }
+    return max_index;
+}
+
+_Static_assert(MLP_TOP_K >= 1 && MLP_TOP_K <= MLP_OUTPUTS, "MLP_TOP_K must be 1 to MLP_OUTPUTS");
 
-        
-        for (int j = 0; j < input_sizes[i + 1]; j++) {
-            current_input[j] = next_input[j];
+// Inserts a class score into top, kept sorted by decreasing score
+// The comparisons with all the entries are unrolled into a chain of compare-and-shift cells.
+// On equal scores the lower class stays first, like the argmax.
+static void topk_insert(ClassScore top[MLP_TOP_K], int label, float score) {
+    #pragma HLS INLINE
+    for (int i = MLP_TOP_K - 1; i >= 0; i--) {
+        #pragma HLS UNROLL
+        if (score > top[i].score) {
+            if (i + 1 < MLP_TOP_K) {
+                top[i + 1] = top[i];
+            }
+            top[i].label = label;
+            top[i].score = score;
         }
     }
+}
+
+// Runs one sample through the network and keeps only its MLP_TOP_K best classes
+// Each output goes into the top-k as soon as the output layer produces it, so the compare chain is
+// part of the datapath of the last layer. Entries scoring below threshold get label -1.
+// Returns the number of entries scoring at least threshold.
+static int classify_topk(const float input[MLP_INPUTS], float threshold, ClassScore top[MLP_TOP_K]) {
+    #pragma HLS INLINE
+    float scores[MLP_OUTPUTS];
+    ClassScore best[MLP_TOP_K];
+    #pragma HLS ARRAY_PARTITION variable=scores complete
+    #pragma HLS ARRAY_PARTITION variable=best complete
+    run_layers(&MLP_PARAMS, input, scores);
+
+    for (int i = 0; i < MLP_TOP_K; i++) {
+        #pragma HLS UNROLL
+        best[i].label = -1;
+        best[i].score = -INFINITY;
+    }
+    for (int i = 0; i < MLP_OUTPUTS; i++) {
+        #pragma HLS UNROLL
+        topk_insert(best, i, scores[i]);
+    }
+
+    int count = 0;
+    for (int i = 0; i < MLP_TOP_K; i++) {
+        #pragma HLS UNROLL
+        int valid = best[i].score >= threshold;
+        top[i].label = valid ? best[i].label : -1;
+        top[i].score = best[i].score;
+        count += valid;
+    }
+    return count;
+}
+
+// Forward pass of one sample: features holds MLP_INPUTS values, scores receives the output layer.
+// Returns the predicted class.
+int forward_scores(const float features[MLP_INPUTS], float scores[MLP_OUTPUTS]) {
+    return classify(&MLP_PARAMS, features, scores);
+}
+
+// Classification-only forward pass of one sample: top receives the MLP_TOP_K best classes by
+// decreasing score (the output layer values); only the entries scoring at least threshold are
+// valid, the others have label -1. Returns the number of valid entries.
+int forward_topk(const float features[MLP_INPUTS], float threshold, ClassScore top[MLP_TOP_K]) {
+    return classify_topk(features, threshold, top);
+}
+
+#ifndef MLP_MODEL
+int forward(float input0, float input1, float input2, float input3) {
+    float input[MLP_INPUTS];
+    float scores[MLP_OUTPUTS];
+
+    input[0] = input0;
+    input[1] = input1;
+    input[2] = input2;
+    input[3] = input3;
+
+    return classify(&MLP_PARAMS, input, scores);
+}
+#endif
+
+// Partitions the weights of a layer into registers, so a whole layer is computed in parallel
+#define MLP_LAYER_PARTITION(name, source, n_in, n_out, activation)            \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=mlp.name.weights complete dim=0)  \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=mlp.name.biases complete)
+
+// Sample loop of the batched top functions, pipelined at II=1: loads sample s of features into
+// input, then calls step(input, s, ...), which classifies it and writes the result of sample s
+#define MLP_BATCH_LOOP(features, n, step, ...)                    \
+    batch_loop: for (int s = 0; s < (n); s++) {                   \
+        MLP_PRAGMA(HLS LOOP_TRIPCOUNT min=1 max=MAX_SAMPLES)      \
+        MLP_PRAGMA(HLS PIPELINE II=1)                             \
+        float input[MLP_INPUTS];                                  \
+        MLP_PRAGMA(HLS ARRAY_PARTITION variable=input complete)   \
+        for (int f = 0; f < MLP_INPUTS; f++) {                    \
+            input[f] = (features)[s * MLP_INPUTS + f];            \
+        }                                                         \
+        step(input, s, __VA_ARGS__);                              \
+    }
+
+// Output steps of MLP_BATCH_LOOP: the predicted class, or the top-k entries, of sample s
+static void class_step(const float input[MLP_INPUTS], int s, int *classes) {
+    #pragma HLS INLINE
+    float scores[MLP_OUTPUTS];
+    classes[s] = classify(&MLP_PARAMS, input, scores);
+}
+
+static void topk_step(const float input[MLP_INPUTS], int s, float threshold, ClassScore *top) {
+    #pragma HLS INLINE
+    ClassScore sample_top[MLP_TOP_K];
+    classify_topk(input, threshold, sample_top);
+    for (int i = 0; i < MLP_TOP_K; i++) {
+        top[s * MLP_TOP_K + i] = sample_top[i];
+    }
+}
+
+// Classifies n samples with the sample loop pipelined at II=1
+static void classify_batch(const float *features, int n, int *classes) {
+    #pragma HLS INLINE
+    MLP_LAYERS(MLP_LAYER_PARTITION)
+    MLP_BATCH_LOOP(features, n, class_step, classes)
+}
+
+// Batched forward pass: classifies n samples in a single call.
+// features holds n rows of MLP_INPUTS floats (same layout as input_data in the testbench),
+// classes receives one predicted class per row.
+// The sample loop is pipelined so a new sample enters the first layer every cycle while the
+// previous ones are still flowing through the next ones, amortizing the per-call overhead over the batch.
+int forward_batch(const float *features, int n, int *classes) {
+    #pragma HLS INTERFACE m_axi port=features offset=slave bundle=gmem0 depth=MAX_SAMPLES*MLP_INPUTS
+    #pragma HLS INTERFACE m_axi port=classes offset=slave bundle=gmem1 depth=MAX_SAMPLES
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=return
 
+    classify_batch(features, n, classes);
+    return 0;
+}
+
+// Batched classification-only forward pass: like forward_batch(), but each sample writes its
+// MLP_TOP_K best classes to top (MLP_TOP_K entries per sample, see forward_topk()) instead of a
+// class, so only the pairs the host asked for are transferred.
+int forward_batch_topk(const float *features, int n, float threshold, ClassScore *top) {
+    #pragma HLS INTERFACE m_axi port=features offset=slave bundle=gmem0 depth=MAX_SAMPLES*MLP_INPUTS
+    #pragma HLS INTERFACE m_axi port=top offset=slave bundle=gmem1 depth=MAX_SAMPLES*MLP_TOP_K
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=threshold
+    #pragma HLS INTERFACE s_axilite port=return
+    MLP_LAYERS(MLP_LAYER_PARTITION)
+    MLP_BATCH_LOOP(features, n, topk_step, threshold, top)
+    return 0;
+}
+
+// Batched forward pass with run-time loadable weights
+// When reload is set, the weights (the payload of a weights file, same layout as MLP) are first
+// burst-read over the AXI master port into the on-chip weight registers, where they stay for the
+// following calls; then the batch is classified exactly like forward_batch().
+int forward_batch_weights(const float *weights, int reload, const float *features, int n, int *classes) {
+    #pragma HLS INTERFACE m_axi port=weights offset=slave bundle=gmem2 depth=MLP_WEIGHT_COUNT
+    #pragma HLS INTERFACE m_axi port=features offset=slave bundle=gmem0 depth=MAX_SAMPLES*MLP_INPUTS
+    #pragma HLS INTERFACE m_axi port=classes offset=slave bundle=gmem1 depth=MAX_SAMPLES
+    #pragma HLS INTERFACE s_axilite port=reload
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=return
+
+    if (reload) {
+        memcpy(&mlp, weights, sizeof(MLP));
+#ifndef __SYNTHESIS__
+        mlp_params = &mlp;
+#endif
+    }
+    classify_batch(features, n, classes);
+    return 0;
+}
+
+/*------------------------ Sparse layers ------------------------*/
+
+#ifndef MLP_MODEL
+#include "MLP_sparse_weights.h"
+
+// Generates <layer>_sparse_forward(): the layer with the pruned weights of MLP_sparse_weights.h
+// (pytorch/prune_weights.py). The row bounds and the input indices are constants, so once the
+// loops are unrolled every output is a fixed chain over its kept weights only: a pruned weight
+// costs no multiplier. The products are added in the same order as <layer>_forward().
+#define MLP_SPARSE_LAYER_KERNEL(name, source, n_in, n_out, activation)                        \
+    static void name##_sparse_forward(const float in[n_in], float out[n_out]) {                \
+        _Pragma("HLS INLINE")                                                                  \
+        for (int j = 0; j < n_out; j++) {                                                      \
+            float sum = MLP_PARAMS.name.biases[j];                                             \
+            for (int n = mlp_sparse_##name##_row_ptr[j]; n < mlp_sparse_##name##_row_ptr[j + 1]; n++) { \
+                sum += mlp_sparse_##name##_values[n] * in[mlp_sparse_##name##_col_idx[n]];     \
+            }                                                                                  \
+            out[j] = (activation) == MLP_ACT_RELU ? reLu(sum) : sum;                           \
+        }                                                                                      \
+        if ((activation) == MLP_ACT_SOFTMAX) {                                                 \
+            softmax(out, n_out);                                                               \
+        }                                                                                      \
+    }
+
+MLP_LAYERS(MLP_SPARSE_LAYER_KERNEL)
+
+#define MLP_SPARSE_LAYER_CALL(name, source, n_in, n_out, activation) \
+    name##_sparse_forward(act_##source, act_##name);
+
+// Partitions the kept weights of a layer into registers
+#define MLP_SPARSE_PARTITION(name, source, n_in, n_out, activation)                    \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=mlp_sparse_##name##_values complete)       \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=mlp_sparse_##name##_col_idx complete)      \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=mlp.name.biases complete)
+
+// Runs one sample through the pruned layers and returns the predicted class
+static int classify_sparse(const float input[MLP_INPUTS]) {
+    #pragma HLS INLINE
+    float act_input[MLP_INPUTS];
+    #pragma HLS ARRAY_PARTITION variable=act_input complete
+    for (int f = 0; f < MLP_INPUTS; f++) {
+        act_input[f] = input[f];
+    }
+    MLP_LAYERS(MLP_LAYER_BUFFER)
+    MLP_LAYERS(MLP_SPARSE_LAYER_CALL)
+
+    const float *output = MLP_ACTIVATIONS(MLP_OUTPUT_LAYER);
     int max_index = 0;
-    float max = current_input[0];
-    for (int i = 1; i < NUM_CLASSES; i++) {
+    for (int i = 0; i < MLP_OUTPUTS; i++) {
         #pragma HLS UNROLL
-        if (current_input[i] > max) {
-            max = current_input[i];
+        if (output[i] > output[max_index]) {
             max_index = i;
         }
     }
     return max_index;
-}
\ No newline at end of file
+}
+
+// Output step of MLP_BATCH_LOOP on the pruned layers
+static void sparse_step(const float input[MLP_INPUTS], int s, int *classes) {
+    #pragma HLS INLINE
+    classes[s] = classify_sparse(input);
+}
+
+// Batched forward pass on the pruned layers: same interface and pipelining as forward_batch(),
+// with one multiplier per kept weight instead of one per weight
+// The pruned weights are compiled in, so this path does not follow forward_batch_weights() reloads.
+int forward_batch_sparse(const float *features, int n, int *classes) {
+    #pragma HLS INTERFACE m_axi port=features offset=slave bundle=gmem0 depth=MAX_SAMPLES*MLP_INPUTS
+    #pragma HLS INTERFACE m_axi port=classes offset=slave bundle=gmem1 depth=MAX_SAMPLES
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=return
+    MLP_LAYERS(MLP_SPARSE_PARTITION)
+    MLP_BATCH_LOOP(features, n, sparse_step, classes)
+    return 0;
+}
+#endif
+
+/*------------------------ Multi-unit dispatch ------------------------*/
+
+_Static_assert(MLP_DISPATCH_UNITS >= 1 && MLP_DISPATCH_UNITS <= 4, "MLP_DISPATCH_UNITS must be 1 to 4");
+
+#define MLP_UNIT_SAMPLES ((MAX_SAMPLES + MLP_DISPATCH_UNITS - 1) / MLP_DISPATCH_UNITS)
+
+// One sample as a single FIFO word, so a unit pops a whole sample per cycle
+typedef struct {
+    float f[MLP_INPUTS];
+} MlpSample;
+
+// Gives every unit its own copy of the weights, so the global weights are read by this stage only
+// and each unit computes from private registers instead of sharing one set of ports.
+static void dispatch_weights(MLP unit_weights[MLP_DISPATCH_UNITS]) {
+    #pragma HLS INLINE off
+    for (int u = 0; u < MLP_DISPATCH_UNITS; u++) {
+        unit_weights[u] = MLP_PARAMS;
+    }
+}
+
+// Deals the samples round-robin to the input FIFOs of the units: sample s goes to unit
+// s % MLP_DISPATCH_UNITS. A round reads MLP_DISPATCH_UNITS consecutive samples, which are
+// contiguous in features, as one wide burst beat and pushes one sample into every FIFO, so the
+// loop runs at II=1 and each unit can take a new sample every cycle.
+static void dispatch_read(const float *features, int n,
+                          MlpSample unit_in[MLP_DISPATCH_UNITS][MLP_UNIT_SAMPLES]) {
+    #pragma HLS INLINE off
+    int rounds = (n + MLP_DISPATCH_UNITS - 1) / MLP_DISPATCH_UNITS;
+    read_loop: for (int r = 0; r < rounds; r++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=MLP_UNIT_SAMPLES
+        #pragma HLS PIPELINE II=1
+        for (int u = 0; u < MLP_DISPATCH_UNITS; u++) {
+            #pragma HLS UNROLL
+            int s = r * MLP_DISPATCH_UNITS + u;
+            if (s < n) {
+                MlpSample sample;
+                for (int f = 0; f < MLP_INPUTS; f++) {
+                    #pragma HLS UNROLL
+                    sample.f[f] = features[s * MLP_INPUTS + f];
+                }
+                unit_in[u][r] = sample;
+            }
+        }
+    }
+}
+
+// Partitions the private weights of a unit into registers
+#define MLP_UNIT_PARTITION(name, source, n_in, n_out, activation)                     \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=weights.name.weights complete dim=0)      \
+    MLP_PRAGMA(HLS ARRAY_PARTITION variable=weights.name.biases complete)
+
+// One compute unit: a full copy of the pipelined network with its own weights, classifying the
+// samples dealt to unit u at one sample per cycle
+static void dispatch_unit(const MLP *unit_weights, MlpSample in[MLP_UNIT_SAMPLES], int n, int u,
+                          int out[MLP_UNIT_SAMPLES]) {
+    #pragma HLS INLINE off
+    MLP weights = *unit_weights;
+    MLP_LAYERS(MLP_UNIT_PARTITION)
+    int count = (n - u + MLP_DISPATCH_UNITS - 1) / MLP_DISPATCH_UNITS;
+
+    unit_loop: for (int i = 0; i < count; i++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=MLP_UNIT_SAMPLES
+        #pragma HLS PIPELINE II=1
+        MlpSample sample = in[i];
+        float scores[MLP_OUTPUTS];
+        #pragma HLS ARRAY_PARTITION variable=sample.f complete
+        out[i] = classify(&weights, sample.f, scores);
+    }
+}
+
+// Reads the result FIFOs in the same round-robin order, so the classes come out in input order
+static void dispatch_collect(int unit_out[MLP_DISPATCH_UNITS][MLP_UNIT_SAMPLES], int n, int *classes) {
+    #pragma HLS INLINE off
+    int rounds = (n + MLP_DISPATCH_UNITS - 1) / MLP_DISPATCH_UNITS;
+    collect_loop: for (int r = 0; r < rounds; r++) {
+        #pragma HLS LOOP_TRIPCOUNT min=1 max=MLP_UNIT_SAMPLES
+        #pragma HLS PIPELINE II=1
+        for (int u = 0; u < MLP_DISPATCH_UNITS; u++) {
+            #pragma HLS UNROLL
+            int s = r * MLP_DISPATCH_UNITS + u;
+            if (s < n) {
+                classes[s] = unit_out[u][r];
+            }
+        }
+    }
+}
+
+// Weights copy, reader, units and collector as a dataflow region
+static void run_dispatch(const float *features, int n, int *classes) {
+    #pragma HLS INLINE off
+    #pragma HLS DATAFLOW
+
+    MLP unit_weights[MLP_DISPATCH_UNITS];
+    MlpSample unit_in[MLP_DISPATCH_UNITS][MLP_UNIT_SAMPLES];
+    int unit_out[MLP_DISPATCH_UNITS][MLP_UNIT_SAMPLES];
+    #pragma HLS ARRAY_PARTITION variable=unit_weights complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=unit_in complete dim=1
+    #pragma HLS ARRAY_PARTITION variable=unit_out complete dim=1
+    #pragma HLS STREAM variable=unit_in depth=8
+    #pragma HLS STREAM variable=unit_out depth=2
+
+    dispatch_weights(unit_weights);
+    dispatch_read(features, n, unit_in);
+    // one call per unit, so HLS instantiates a separate copy of the network for each
+    dispatch_unit(&unit_weights[0], unit_in[0], n, 0, unit_out[0]);
+#if MLP_DISPATCH_UNITS > 1
+    dispatch_unit(&unit_weights[1], unit_in[1], n, 1, unit_out[1]);
+#endif
+#if MLP_DISPATCH_UNITS > 2
+    dispatch_unit(&unit_weights[2], unit_in[2], n, 2, unit_out[2]);
+#endif
+#if MLP_DISPATCH_UNITS > 3
+    dispatch_unit(&unit_weights[3], unit_in[3], n, 3, unit_out[3]);
+#endif
+    dispatch_collect(unit_out, n, classes);
+}
+
+// Batched forward pass on MLP_DISPATCH_UNITS copies of the network running concurrently.
+// A reader stage deals the samples to the units through FIFOs, each unit classifies its share
+// on its own pipelined datapath, and a collector stage merges the results back in input order.
+// Same interface and results as forward_batch(), with MLP_DISPATCH_UNITS samples classified
+// per cycle instead of one: the ports are widened so a beat carries a whole round of samples
+// (MLP_DISPATCH_UNITS * MLP_INPUTS floats, 512 bits for 4 units of the iris model) or of classes.
+// The unit buffers hold MAX_SAMPLES samples in all: returns -1 without reading features if n is
+// not 0 to MAX_SAMPLES, 0 otherwise.
+int forward_dispatch(const float *features, int n, int *classes) {
+    #pragma HLS INTERFACE m_axi port=features offset=slave bundle=gmem0 depth=MAX_SAMPLES*MLP_INPUTS max_widen_bitwidth=512
+    #pragma HLS INTERFACE m_axi port=classes offset=slave bundle=gmem1 depth=MAX_SAMPLES max_widen_bitwidth=128
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=return
+
+    if (n < 0 || n > MAX_SAMPLES) {
+        return -1;
+    }
+    run_dispatch(features, n, classes);
+    return 0;
+}
+
+/*------------------------ Profiling ------------------------*/
+
+#ifdef MLP_PROFILE
+#define MLP_LAYER_READ(name, source, n_in, n_out, activation) *counters++ = profile_##name;
+#define MLP_LAYER_RESET(name, source, n_in, n_out, activation) profile_##name = zero;
+
+void mlp_profile_read(LayerCounters counters[MLP_NUM_LAYERS]) {
+    MLP_LAYERS(MLP_LAYER_READ)
+}
+
+void mlp_profile_reset(void) {
+    LayerCounters zero = {0};
+    MLP_LAYERS(MLP_LAYER_RESET)
+}
+
+#ifdef __SYNTHESIS__
+// Output step of the profiled sample loop: classifies sample s and latches the cycle counter, so the
+// first and last iterations bound the loop
+static void profiled_step(const float input[MLP_INPUTS], int s, int *classes,
+                          const volatile uint64_t *cycle_counter, uint64_t *first, uint64_t *last) {
+    #pragma HLS INLINE
+    float scores[MLP_OUTPUTS];
+    classes[s] = classify(&MLP_PARAMS, input, scores);
+    uint64_t now = *cycle_counter;
+    if (s == 0) {
+        *first = now;
+    }
+    *last = now;
+}
+
+// Cycles of the sample loop, added to every layer since the layers run in it together. Without
+// stalls consecutive samples start one cycle apart: any extra cycle between the first and the last
+// one was spent waiting on the features or classes port.
+#define MLP_LAYER_LOOP_CYCLES(name, source, n_in, n_out, activation)          \
+    profile_##name.time += end - start;                                       \
+    profile_##name.stall_cycles += last - first > busy ? last - first - busy : 0;
+#endif
+
+// Profiled batched forward pass: same as forward_batch(), and exports the counters of all the
+// layers, accumulated since the last reset, as AXI-lite status registers
+// cycle_counter is a plain input wired to a free-running counter of the kernel clock, latched at
+// the start and end of the sample loop and at every sample. The host times each layer with
+// profile_clock() instead and ignores it (pass NULL).
+int forward_batch_profiled(const float *features, int n, int *classes, LayerCounters counters[MLP_NUM_LAYERS],
+                           const volatile uint64_t *cycle_counter) {
+    #pragma HLS INTERFACE m_axi port=features offset=slave bundle=gmem0 depth=MAX_SAMPLES*MLP_INPUTS
+    #pragma HLS INTERFACE m_axi port=classes offset=slave bundle=gmem1 depth=MAX_SAMPLES
+    #pragma HLS INTERFACE s_axilite port=n
+    #pragma HLS INTERFACE s_axilite port=counters
+    #pragma HLS INTERFACE ap_none port=cycle_counter
+    #pragma HLS INTERFACE s_axilite port=return
+
+#ifdef __SYNTHESIS__
+    MLP_LAYERS(MLP_LAYER_PARTITION)
+    uint64_t first = 0, last = 0;
+    uint64_t start = *cycle_counter;
+    MLP_BATCH_LOOP(features, n, profiled_step, classes, cycle_counter, &first, &last)
+    uint64_t end = *cycle_counter;
+    uint64_t busy = n > 0 ? n - 1 : 0;
+    MLP_LAYERS(MLP_LAYER_LOOP_CYCLES)
+#else
+    classify_batch(features, n, classes);
+#endif
+    mlp_profile_read(counters);
+    return 0;
+}
+#endif
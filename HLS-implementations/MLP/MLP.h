@@ -1,29 +1,116 @@
 #ifndef MLP_H
 #define MLP_H
 
-#define MAX_LAYERS 3                // max number of layers
-#define MAX_NEURONS 100             // max neurons per layer
+#include <stdint.h>
+
+// Generic dense-network engine: the layers are described by a model descriptor (see MLP_model.h),
+// and MLP.c generates the weight structure and the pipelined kernels from it.
+// Build with -DMLP_MODEL='"my_model.h"' to use another descriptor; such a model has no
+// compiled-in weights and loads them from a weights file (pytorch/export_weights_bin.py).
+
+// Layer activations
+#define MLP_ACT_NONE 0              // identity (logits)
+#define MLP_ACT_RELU 1              // max(x, 0)
+#define MLP_ACT_SOFTMAX 2           // softmax over the whole layer output
+
+#ifdef MLP_MODEL
+#include MLP_MODEL
+#else
+#include "MLP_model.h"
+#endif
+
 #define MAX_SAMPLES 1000            // max number of samples
-#define MAX_FEATURES 4              // max number of features per sample
-#define NUM_CLASSES 3               // number of classes
+#define MAX_FEATURES MLP_INPUTS     // max number of features per sample
+#define NUM_CLASSES MLP_OUTPUTS     // number of classes
 #define LEARNING_RATE 0.01          // learning rate
-#define OUTPUT_SIZE 3               // output size
+#define OUTPUT_SIZE MLP_OUTPUTS     // output size
+#define Q_ACT_FRAC_BITS 8           // fractional bits of the int16 activations (quantized path)
+
+// Classes returned by forward_topk() / forward_batch_topk() (1 to MLP_OUTPUTS), set with -DMLP_TOP_K=N
+#ifndef MLP_TOP_K
+#define MLP_TOP_K 2
+#endif
+
+// Compute units instantiated by forward_dispatch() (1 to 4), set with -DMLP_DISPATCH_UNITS=N
+#ifndef MLP_DISPATCH_UNITS
+#define MLP_DISPATCH_UNITS 2
+#endif
 
 /*------------------------ Data Structures ------------------------*/
 
-typedef struct {
-    float weights[MAX_NEURONS][MAX_NEURONS];  // weights of the layer
-    float biases[MAX_NEURONS];   // biases of the layer
-    float output[MAX_NEURONS];   // output of the layer
-} Layer;
+// Declares the weights of a dense layer, sized exactly for its shape
+#define MLP_LAYER_STRUCT(name, source, n_in, n_out, activation)  \
+    struct {                                                    \
+        float weights[n_out][n_in];  /* weights of the layer */ \
+        float biases[n_out];         /* biases of the layer */  \
+    } name;
 
+// Weights of the network, one field per layer of the descriptor
 typedef struct {
-    int num_layers;              // number of layers
-    Layer layers[MAX_LAYERS];    // layers of the MLP (array of layers)
+    MLP_LAYERS(MLP_LAYER_STRUCT)
 } MLP;
 
+// Number of floats in the weights of the network (the fields of MLP, back to back)
+#define MLP_LAYER_WEIGHT_COUNT(name, source, n_in, n_out, activation) + (n_out) * ((n_in) + 1)
+#define MLP_WEIGHT_COUNT (0 MLP_LAYERS(MLP_LAYER_WEIGHT_COUNT))
+
+// Declares the weights of an int8 dense layer for the quantized path (biases are in accumulator units)
+#define MLP_QUANTIZED_LAYER_STRUCT(name, source, n_in, n_out, activation)       \
+    struct {                                                                \
+        int8_t weights[n_out][n_in];  /* weights, real = q * layer scale */ \
+        int32_t biases[n_out];        /* biases, in accumulator units */    \
+    } name;
+
+typedef struct {
+    MLP_LAYERS(MLP_QUANTIZED_LAYER_STRUCT)
+} QuantizedMLP;
+
+// One entry of the top-k output of forward_topk() / forward_batch_topk()
+typedef struct {
+    int label;                       // class, -1 if the entry is below the threshold
+    float score;                     // output layer value of the class
+} ClassScore;
+
+// Number of layers of the descriptor
+#define MLP_LAYER_ONE(name, source, n_in, n_out, activation) + 1
+#define MLP_NUM_LAYERS (0 MLP_LAYERS(MLP_LAYER_ONE))
+
+#ifdef MLP_PROFILE
+// Layers reported by the profiling counters (-DMLP_PROFILE), in the order of the descriptor
+#define MLP_LAYER_NAME(name, source, n_in, n_out, activation) #name,
+#define MLP_PROFILE_LAYER_NAMES {MLP_LAYERS(MLP_LAYER_NAME)}
+
+// Counters of one layer, accumulated over all the samples since the last reset
+typedef struct {
+    uint64_t calls;                  // samples processed
+    uint64_t time;                   // time spent: profile_clock() units on the host, kernel clock cycles of the
+                                     // whole sample loop on the FPGA
+    uint64_t stall_cycles;           // FPGA only: cycles the sample loop waited on the memory ports
+    uint64_t macs;                   // multiply-accumulates
+} LayerCounters;
+#endif
+
 /*-------------------------- Functions ---------------------------*/
 
+int forward_scores(const float features[MLP_INPUTS], float scores[MLP_OUTPUTS]);
+int forward_topk(const float features[MLP_INPUTS], float threshold, ClassScore top[MLP_TOP_K]);
+int forward_batch(const float *features, int n, int *classes);
+int forward_batch_topk(const float *features, int n, float threshold, ClassScore *top);
+int forward_batch_weights(const float *weights, int reload, const float *features, int n, int *classes);
+int forward_dispatch(const float *features, int n, int *classes);
+
+#ifdef MLP_PROFILE
+int forward_batch_profiled(const float *features, int n, int *classes, LayerCounters counters[MLP_NUM_LAYERS],
+                           const volatile uint64_t *cycle_counter);
+void mlp_profile_read(LayerCounters counters[MLP_NUM_LAYERS]);
+void mlp_profile_reset(void);
+#endif
+
+#ifndef MLP_MODEL
+// Entry points of the default iris model
 int forward(float input0, float input1, float input2, float input3);
+int forward_batch_sparse(const float *features, int n, int *classes);
+int forward_quantized(float input0, float input1, float input2, float input3);
+#endif
 
 #endif // MLP_H
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "MLP_host.h"
+#include "../host/simd_kernels.h"
+#include "../host/weights_file.h"
+#ifdef MLP_PROFILE
+#include "../host/profile_clock.h"
+#endif
+#include <stddef.h>
+#include <string.h>
+
+// Tensors of a weights file, in the order of the MLP fields
+#define MLP_LAYER_TENSORS(name, source, n_in, n_out, activation) \
+    {#name ".weight", 2, {n_out, n_in}},                         \
+    {#name ".bias", 1, {n_out}},
+
+static const WeightsTensorSpec mlp_tensors[] = {
+    MLP_LAYERS(MLP_LAYER_TENSORS)
+};
+
+// The payload is used as an MLP structure, which is only possible without padding
+_Static_assert(sizeof(MLP) == MLP_WEIGHT_COUNT * sizeof(float), "MLP must be a packed array of floats");
+
+static WeightsFile mapped_weights;
+
+int mlp_map_weights(const char *path) {
+    WeightsFile file;
+    if (weights_file_open(path, mlp_tensors, sizeof(mlp_tensors) / sizeof(mlp_tensors[0]), &file) != 0) {
+        return -1;
+    }
+    mlp_unmap_weights();
+    mapped_weights = file;
+    mlp_params = (const MLP *)mapped_weights.payload;
+    return 0;
+}
+
+void mlp_unmap_weights(void) {
+    mlp_params = &mlp;
+    weights_file_close(&mapped_weights);
+}
+
+int mlp_load_weights(const char *path) {
+    if (mlp_map_weights(path) != 0) {
+        return -1;
+    }
+    memcpy(&mlp, mlp_params, sizeof(MLP));
+    mlp_unmap_weights();
+    return 0;
+}
+
+int mlp_classify_sample(const void *sample, void *scratch) {
+    float scores[MLP_OUTPUTS];
+    (void)scratch;
+    return forward_scores(sample, scores);
+}
+
+int mlp_classify_batch(const void *samples, int count, int *predictions, void *scratch) {
+    (void)scratch;
+    return forward_batch(samples, count, predictions);
+}
+
+int mlp_classify_dispatch(const void *samples, int count, int *predictions, void *scratch) {
+    (void)scratch;
+    return forward_dispatch(samples, count, predictions);
+}
+
+// Output buffer of a layer on the SIMD and sparse CPU paths
+#define MLP_SIMD_BUFFER(name, source, n_in, n_out, activation) float act_##name[n_out];
+
+// Runs a layer on the SIMD path; softmax does not change the predicted class and is skipped
+#define MLP_SIMD_LAYER(name, source, n_in, n_out, activation)                            \
+    simd_dense(&mlp_params->name.weights[0][0], mlp_params->name.biases, act_##source, \
+               act_##name, n_in, n_out, (activation) == MLP_ACT_RELU);
+
+#define MLP_SIMD_OUTPUT(name) MLP_SIMD_OUTPUT_(name)
+#define MLP_SIMD_OUTPUT_(name) act_##name
+
+int mlp_forward_simd(const float features[MLP_INPUTS]) {
+    const float *act_input = features;
+    MLP_LAYERS(MLP_SIMD_BUFFER)
+
+    // same layers as forward_scores()
+    MLP_LAYERS(MLP_SIMD_LAYER)
+
+    const float *output = MLP_SIMD_OUTPUT(MLP_OUTPUT_LAYER);
+    int max_index = 0;
+    for (int i = 1; i < MLP_OUTPUTS; i++) {
+        if (output[i] > output[max_index]) {
+            max_index = i;
+        }
+    }
+    return max_index;
+}
+
+int mlp_classify_sample_simd(const void *sample, void *scratch) {
+    (void)scratch;
+    return mlp_forward_simd(sample);
+}
+
+// Prunes a layer into the next entry of layers
+#define MLP_PRUNE_LAYER(name, source, n_in, n_out, activation)                                   \
+    if (sparse_layer_prune(&mlp_params->name.weights[0][0], n_out, n_in, ratio, &layers[l++]) != 0) { \
+        mlp_sparse_free(layers);                                                                 \
+        return -1;                                                                               \
+    }
+
+int mlp_prune(double ratio, SparseLayer layers[MLP_NUM_LAYERS]) {
+    SparseLayer empty = {0};
+    for (int l = 0; l < MLP_NUM_LAYERS; l++) {
+        layers[l] = empty;
+    }
+    int l = 0;
+    MLP_LAYERS(MLP_PRUNE_LAYER)
+    return 0;
+}
+
+void mlp_sparse_free(SparseLayer layers[MLP_NUM_LAYERS]) {
+    for (int l = 0; l < MLP_NUM_LAYERS; l++) {
+        sparse_layer_free(&layers[l]);
+    }
+}
+
+// Runs a pruned layer; softmax does not change the predicted class and is skipped
+#define MLP_SPARSE_LAYER(name, source, n_in, n_out, activation)                          \
+    sparse_layer_forward(&layers[l++], mlp_params->name.biases, act_##source, act_##name, \
+                         (activation) == MLP_ACT_RELU);
+
+int mlp_forward_sparse(const float features[MLP_INPUTS], const SparseLayer layers[MLP_NUM_LAYERS]) {
+    const float *act_input = features;
+    MLP_LAYERS(MLP_SIMD_BUFFER)
+
+    int l = 0;
+    MLP_LAYERS(MLP_SPARSE_LAYER)
+
+    const float *output = MLP_SIMD_OUTPUT(MLP_OUTPUT_LAYER);
+    int max_index = 0;
+    for (int i = 1; i < MLP_OUTPUTS; i++) {
+        if (output[i] > output[max_index]) {
+            max_index = i;
+        }
+    }
+    return max_index;
+}
+
+#ifdef MLP_PROFILE
+void mlp_profile_print(FILE *out) {
+    static const char *const names[MLP_NUM_LAYERS] = MLP_PROFILE_LAYER_NAMES;
+    LayerCounters counters[MLP_NUM_LAYERS];
+    mlp_profile_read(counters);
+
+    uint64_t total = 0;
+    for (int l = 0; l < MLP_NUM_LAYERS; l++) {
+        total += counters[l].time;
+    }
+    fprintf(out, "%-6s %10s %7s %17s %12s\n", "layer", "samples", "time", PROFILE_CLOCK_UNIT "/sample", "MACs/sample");
+    for (int l = 0; l < MLP_NUM_LAYERS; l++) {
+        double calls = counters[l].calls ? (double)counters[l].calls : 1.0;
+        fprintf(out, "%-6s %10llu %6.1f%% %17.1f %12.0f\n", names[l], (unsigned long long)counters[l].calls,
+                total ? 100.0 * counters[l].time / total : 0.0, counters[l].time / calls, counters[l].macs / calls);
+    }
+}
+#endif
@@ -0,0 +1,60 @@
+#ifndef MLP_HOST_H
+#define MLP_HOST_H
+
+#include "MLP.h"
+#include "../host/sparse_layer.h"
+#include <stdio.h>
+
+// Host-side glue between the MLP and the tools in ../host (testbench and CPU runs only, not synthesized)
+
+extern MLP mlp;                  // network weights, defined in MLP.c
+extern const MLP *mlp_params;    // weights used by the host build (&mlp or a mapped weights file)
+#ifndef MLP_MODEL
+extern const double mlp_sparse_ratio; // pruning ratio of the layers of forward_batch_sparse() (MLP_sparse_weights.h)
+#endif
+
+/*-------------------------- Functions ---------------------------*/
+
+// Memory-maps a weights file (pytorch/export_weights_bin.py) and makes the network use it in place
+// Returns 0 on success, -1 if the file is missing or does not match the compiled network.
+int mlp_map_weights(const char *path);
+
+// Unmaps the file and goes back to the compiled-in weights
+void mlp_unmap_weights(void);
+
+// Copies a weights file into the weight tables of mlp, as the reload of forward_batch_weights() does
+// on the FPGA. -DMLP_EXTERNAL_WEIGHTS builds have no weights until this is done.
+// Returns 0 on success, -1 if the file is missing or does not match the compiled network.
+int mlp_load_weights(const char *path);
+
+// ClassifyFn for the inference pool: sample points to MLP_INPUTS floats, no scratch needed
+int mlp_classify_sample(const void *sample, void *scratch);
+
+// Batch kernels of the benchmark: classify count samples (MLP_INPUTS floats each, at most
+// MAX_SAMPLES) with one forward_batch() or forward_dispatch() call, no scratch needed
+int mlp_classify_batch(const void *samples, int count, int *predictions, void *scratch);
+int mlp_classify_dispatch(const void *samples, int count, int *predictions, void *scratch);
+
+// CPU forward pass on the vectorized kernels of ../host/simd_kernels.h, returns the predicted class
+int mlp_forward_simd(const float features[MLP_INPUTS]);
+
+// ClassifyFn running mlp_forward_simd()
+int mlp_classify_sample_simd(const void *sample, void *scratch);
+
+// Magnitude-prunes every layer of the weights in use at ratio into layers (one per layer, in order)
+// Returns 0 on success, -1 if the memory could not be allocated.
+int mlp_prune(double ratio, SparseLayer layers[MLP_NUM_LAYERS]);
+
+// Frees the layers filled by mlp_prune()
+void mlp_sparse_free(SparseLayer layers[MLP_NUM_LAYERS]);
+
+// CPU forward pass on pruned layers (../host/sparse_layer.h), returns the predicted class
+int mlp_forward_sparse(const float features[MLP_INPUTS], const SparseLayer layers[MLP_NUM_LAYERS]);
+
+#ifdef MLP_PROFILE
+// Prints the host profiling counters of the layers: share of the measured time, and measured time
+// and MACs per sample
+void mlp_profile_print(FILE *out);
+#endif
+
+#endif // MLP_HOST_H
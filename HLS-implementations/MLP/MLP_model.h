@@ -0,0 +1,33 @@
+#ifndef MLP_MODEL_H
+#define MLP_MODEL_H
+
+// Model descriptor of the iris classifier, the default model of the MLP engine (see MLP.h).
+//
+// A descriptor defines:
+//   MLP_INPUTS             features per sample
+//   MLP_OUTPUTS            output width (number of classes)
+//   MLP_LAYERS(LAYER)      the dense layers in order, each as
+//                          LAYER(name, source, n_in, n_out, activation)
+//                          source is the name of the previous layer, or input for the first one;
+//                          activation is MLP_ACT_RELU, MLP_ACT_NONE or MLP_ACT_SOFTMAX
+//   MLP_OUTPUT_LAYER       name of the last layer
+
+#define MLP_INPUTS 4                // iris features
+#define MLP_OUTPUTS 3               // iris species
+
+// Layer shapes
+#define FC1_INPUTS MLP_INPUTS       // fc1 input size
+#define FC1_OUTPUTS 10              // fc1 output size
+#define FC2_INPUTS FC1_OUTPUTS      // fc2 input size
+#define FC2_OUTPUTS 10              // fc2 output size
+#define FC3_INPUTS FC2_OUTPUTS      // fc3 input size
+#define FC3_OUTPUTS MLP_OUTPUTS     // fc3 output size
+
+#define MLP_LAYERS(LAYER)                                        \
+    LAYER(fc1, input, FC1_INPUTS, FC1_OUTPUTS, MLP_ACT_RELU)     \
+    LAYER(fc2, fc1, FC2_INPUTS, FC2_OUTPUTS, MLP_ACT_RELU)       \
+    LAYER(fc3, fc2, FC3_INPUTS, FC3_OUTPUTS, MLP_ACT_NONE)
+
+#define MLP_OUTPUT_LAYER fc3
+
+#endif // MLP_MODEL_H
@@ -0,0 +1,78 @@
+#include "MLP.h"
+
+// Quantized forward pass: int8 weights with one scale per layer, int16 activations with
+// Q_ACT_FRAC_BITS fractional bits and int32 accumulators. The tables in MLP_quantized_weights.h
+// are generated from pytorch/mlp_weights.txt by pytorch/quantize_weights.py, so this path only
+// exists for the default iris model.
+#ifndef MLP_MODEL
+#include "MLP_quantized_weights.h"
+
+// Converts a float feature to an int16 activation
+static int16_t quantize(float x) {
+    #pragma HLS INLINE
+    float scaled = x * (1 << Q_ACT_FRAC_BITS);
+    if (scaled >= INT16_MAX) return INT16_MAX;
+    if (scaled <= INT16_MIN) return INT16_MIN;
+    return (int16_t)(scaled + (scaled >= 0 ? 0.5f : -0.5f));
+}
+
+// Scales an accumulator back to an int16 activation (acc * mult / 2^shift), applying ReLU if relu is set
+static int16_t requantize(int32_t acc, int32_t mult, int shift, int relu) {
+    #pragma HLS INLINE
+    int64_t scaled = ((int64_t)acc * mult + ((int64_t)1 << (shift - 1))) >> shift;
+    if (relu && scaled < 0) return 0;
+    if (scaled < INT16_MIN) return INT16_MIN;
+    if (scaled > INT16_MAX) return INT16_MAX;
+    return (int16_t)scaled;
+}
+
+// Generates <layer>_forward_quantized(): an int8 dense layer followed by its activation
+// (MLP_ACT_RELU or MLP_ACT_NONE; softmax does not change the predicted class and is skipped)
+#define QUANTIZED_DENSE_KERNEL(layer, LAYER, n_in, n_out, activation)                  \
+    static void layer##_forward_quantized(const int16_t in[n_in], int16_t out[n_out]) { \
+        _Pragma("HLS INLINE")                                                          \
+        for (int j = 0; j < n_out; j++) {                                              \
+            int32_t sum = mlp_quantized.layer.biases[j];                               \
+            for (int k = 0; k < n_in; k++) {                                           \
+                sum += mlp_quantized.layer.weights[j][k] * in[k];                      \
+            }                                                                          \
+            out[j] = requantize(sum, Q_##LAYER##_MULT, Q_##LAYER##_SHIFT,              \
+                                (activation) == MLP_ACT_RELU);                         \
+        }                                                                              \
+    }
+
+QUANTIZED_DENSE_KERNEL(fc1, FC1, FC1_INPUTS, FC1_OUTPUTS, MLP_ACT_RELU)
+QUANTIZED_DENSE_KERNEL(fc2, FC2, FC2_INPUTS, FC2_OUTPUTS, MLP_ACT_RELU)
+QUANTIZED_DENSE_KERNEL(fc3, FC3, FC3_INPUTS, FC3_OUTPUTS, MLP_ACT_NONE)
+
+int forward_quantized(float input0, float input1, float input2, float input3) {
+    int16_t input[FC1_INPUTS];
+    int16_t fc1_output[FC1_OUTPUTS];
+    int16_t fc2_output[FC2_OUTPUTS];
+    int16_t fc3_output[FC3_OUTPUTS];
+    #pragma HLS ARRAY_PARTITION variable=input complete
+    #pragma HLS ARRAY_PARTITION variable=fc1_output complete
+    #pragma HLS ARRAY_PARTITION variable=fc2_output complete
+    #pragma HLS ARRAY_PARTITION variable=fc3_output complete
+
+    input[0] = quantize(input0);
+    input[1] = quantize(input1);
+    input[2] = quantize(input2);
+    input[3] = quantize(input3);
+
+    fc1_forward_quantized(input, fc1_output);
+    fc2_forward_quantized(fc1_output, fc2_output);
+    fc3_forward_quantized(fc2_output, fc3_output);
+
+    int max_index = 0;
+    int16_t max = fc3_output[0];
+    for (int i = 1; i < NUM_CLASSES; i++) {
+        #pragma HLS UNROLL
+        if (fc3_output[i] > max) {
+            max = fc3_output[i];
+            max_index = i;
+        }
+    }
+    return max_index;
+}
+#endif
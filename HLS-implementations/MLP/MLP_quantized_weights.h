@@ -0,0 +1,57 @@
+// Generated by pytorch/quantize_weights.py from pytorch/mlp_weights.txt, do not edit.
+#ifndef MLP_QUANTIZED_WEIGHTS_H
+#define MLP_QUANTIZED_WEIGHTS_H
+
+// Per-layer weight scales: real weight = q * SCALE, SCALE ~= MULT / 2^SHIFT
+#define Q_FC1_SCALE 0.00854833071f
+#define Q_FC1_MULT 17927
+#define Q_FC1_SHIFT 21
+#define Q_FC2_SCALE 0.006679f
+#define Q_FC2_MULT 28014
+#define Q_FC2_SHIFT 22
+#define Q_FC3_SCALE 0.00751583465f
+#define Q_FC3_MULT 31524
+#define Q_FC3_SHIFT 22
+
+const QuantizedMLP mlp_quantized = {
+    .fc1 = {
+        .weights = {
+            {12, -53, 112, 61},
+            {26, -78, 90, 46},
+            {112, 109, -10, -104},
+            {20, -31, -56, -20},
+            {-39, -15, 50, -4},
+            {21, -63, 80, 84},
+            {17, 59, -32, -23},
+            {-9, 24, -47, -9},
+            {12, -47, -43, -36},
+            {-61, -15, 78, 127}
+        },
+        .biases = {-23378, -3437, 34059, 3475, -7005, -7707, 371, -2592, -9363, -19978}
+    },
+    .fc2 = {
+        .weights = {
+            {-65, -81, 38, 18, 15, 3, 54, -11, 31, -23},
+            {-44, 18, -44, 4, 24, -13, 19, 27, -6, -21},
+            {-45, 6, -8, 25, -31, 6, -43, 13, -7, -33},
+            {34, 46, -48, -4, -14, 60, 6, -28, 2, 114},
+            {8, -7, -36, 33, 2, -47, -34, 13, -42, -17},
+            {109, 97, -10, 30, -4, 50, -56, -15, -11, 71},
+            {-89, -31, 121, -5, 29, -11, 7, 41, -25, -112},
+            {13, -48, -23, 35, 19, -2, 14, -28, 9, -2},
+            {107, 65, 19, 35, 40, 127, -81, -9, 36, 87},
+            {-75, -45, 125, -4, -24, -63, 72, 29, 23, -75}
+        },
+        .biases = {14987, -3929, 4322, -19280, 11838, -11527, 21052, -8710, 8305, 9634}
+    },
+    .fc3 = {
+        .weights = {
+            {96, -29, -28, -32, 17, -67, 74, 30, -90, 68},
+            {-104, 41, 13, -105, -31, 5, 86, -25, 18, 14},
+            {-22, 8, 29, 59, -9, 97, -127, 18, 34, -96}
+        },
+        .biases = {-1787, 18189, -5847}
+    }
+};
+
+#endif // MLP_QUANTIZED_WEIGHTS_H
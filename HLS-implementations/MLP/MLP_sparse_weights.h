@@ -0,0 +1,54 @@
+// Generated by pytorch/prune_weights.py from pytorch/mlp_weights.txt, do not edit.
+#ifndef MLP_SPARSE_WEIGHTS_H
+#define MLP_SPARSE_WEIGHTS_H
+
+// Fully connected layers pruned to ratio 0.3, in CSR form: the kept weights of output j
+// are values[row_ptr[j] .. row_ptr[j + 1] - 1], at inputs col_idx[...]
+const double mlp_sparse_ratio = 0.3;
+
+// fc1: 28 of 40 weights kept
+#define MLP_SPARSE_FC1_NNZ 28
+const int mlp_sparse_fc1_row_ptr[11] = {0, 3, 7, 10, 12, 14, 17, 20, 22, 25, 28};
+const uint8_t mlp_sparse_fc1_col_idx[MLP_SPARSE_FC1_NNZ] = {
+    1, 2, 3, 0, 1, 2, 3, 0, 1, 3, 1, 2, 0, 2, 1, 2, 3, 1, 2, 3, 1, 2, 1, 2, 3, 0, 2, 3
+};
+const float mlp_sparse_fc1_values[MLP_SPARSE_FC1_NNZ] = {
+    -0.452716, 0.957605, 0.517334, 0.22056, -0.666361, 0.772435, 0.389321, 0.957434,
+    0.931137, -0.886874, -0.2619, -0.481757, -0.32919, 0.428382, -0.538837, 0.6822,
+    0.713888, 0.507604, -0.269793, -0.199517, 0.202625, -0.398569, -0.398583, -0.366854,
+    -0.304911, -0.525624, 0.663196, 1.085638
+};
+
+// fc2: 70 of 100 weights kept
+#define MLP_SPARSE_FC2_NNZ 70
+const int mlp_sparse_fc2_row_ptr[11] = {0, 8, 15, 20, 26, 32, 39, 46, 52, 61, 70};
+const uint8_t mlp_sparse_fc2_col_idx[MLP_SPARSE_FC2_NNZ] = {
+    0, 1, 2, 3, 4, 6, 8, 9, 0, 1, 2, 4, 6, 7, 9, 0, 3, 4, 6, 9, 0, 1, 2, 5, 7, 9, 2, 3, 5, 6, 8, 9,
+    0, 1, 3, 5, 6, 7, 9, 0, 1, 2, 4, 7, 8, 9, 1, 2, 3, 4, 6, 7, 0, 1, 2, 3, 4, 5, 6, 8, 9, 0, 1, 2,
+    4, 5, 6, 7, 8, 9
+};
+const float mlp_sparse_fc2_values[MLP_SPARSE_FC2_NNZ] = {
+    -0.43556, -0.538333, 0.253035, 0.120499, 0.098796, 0.362046, 0.207683, -0.152756,
+    -0.295931, 0.123051, -0.294462, 0.159673, 0.12429, 0.177104, -0.142208, -0.299856,
+    0.167064, -0.207485, -0.288037, -0.220476, 0.228607, 0.308247, -0.321292, 0.40065,
+    -0.184433, 0.760814, -0.241395, 0.217187, -0.315055, -0.225099, -0.281209, -0.110815,
+    0.730003, 0.647504, 0.202805, 0.331941, -0.374136, -0.101397, 0.472928, -0.591532,
+    -0.205189, 0.809988, 0.190923, 0.272477, -0.167278, -0.746578, -0.317306, -0.151554,
+    0.234929, 0.126355, 0.094182, -0.18678, 0.712435, 0.435129, 0.125985, 0.231775,
+    0.269586, 0.848233, -0.5405, 0.2411, 0.581109, -0.498703, -0.301602, 0.832068,
+    -0.160015, -0.421864, 0.481599, 0.196709, 0.155504, -0.502033
+};
+
+// fc3: 21 of 30 weights kept
+#define MLP_SPARSE_FC3_NNZ 21
+const int mlp_sparse_fc3_row_ptr[4] = {0, 9, 15, 21};
+const uint8_t mlp_sparse_fc3_col_idx[MLP_SPARSE_FC3_NNZ] = {
+    0, 1, 2, 3, 5, 6, 7, 8, 9, 0, 1, 3, 4, 6, 7, 2, 3, 5, 6, 8, 9
+};
+const float mlp_sparse_fc3_values[MLP_SPARSE_FC3_NNZ] = {
+    0.723252, -0.21671, -0.209677, -0.236799, -0.505804, 0.557877, 0.228974, -0.673829,
+    0.511271, -0.780301, 0.307417, -0.792102, -0.230814, 0.645035, -0.187485, 0.221582,
+    0.44027, 0.727096, -0.954511, 0.253526, -0.723126
+};
+
+#endif // MLP_SPARSE_WEIGHTS_H
@@ -0,0 +1,38 @@
+#include "MLP.h"
+#include "MLP_host.h"
+#include "../host/benchmark.h"
+
+// Host-only speed benchmark of the MLP forward pass (see ../host/benchmark.h for the options)
+// Build it like the testbench, with benchmark.c in place of testbench.c.
+
+// Floating-point operations of one forward pass: a multiply and an add per weight
+#define MLP_LAYER_FLOPS(name, source, n_in, n_out, activation) + 2.0 * (n_in) * (n_out)
+#define MLP_FLOPS (0 MLP_LAYERS(MLP_LAYER_FLOPS))
+
+int main(int argc, char **argv) {
+    BenchmarkConfig config;
+    if (benchmark_parse_args(argc, argv, &config) != 0) {
+        return 1;
+    }
+
+    BenchmarkTarget target = {
+        .network = "mlp",
+        .sample_floats = MLP_INPUTS,
+        .input_min = 0.0f,           // range of the iris features
+        .input_max = 8.0f,
+        .flops_per_sample = MLP_FLOPS,
+        .kernels = {
+            {"reference", mlp_classify_sample, 0},
+            {"simd", mlp_classify_sample_simd, 0},
+            {"batch", NULL, 0, mlp_classify_batch, MAX_SAMPLES},
+            {"dispatch", NULL, 0, mlp_classify_dispatch, MAX_SAMPLES}
+        },
+        .num_kernels = 4
+    };
+    int status = benchmark_run(&target, &config);
+#ifdef MLP_PROFILE
+    // Per-layer breakdown of the reference kernel (the SIMD kernels are not instrumented)
+    mlp_profile_print(stderr);
+#endif
+    return status;
+}
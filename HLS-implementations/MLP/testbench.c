@@ -1,52 +1,303 @@
 #include "MLP.h"
+#include "MLP_host.h"
+#include "../host/dataset_reader.h"
+#include "../host/dispatcher.h"
+#include "../host/inference_pool.h"
+#include "../host/simd_kernels.h"
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#define DATASET_PATH "./datasets/iris_dataset/iris_dataset_encoded.txt"
+#define WEIGHTS_PATH "./pytorch/mlp_weights.bin"
+#define BATCH_SIZE 64                // samples per forward_batch() call
+#define DISPATCH_UNITS 2             // host dispatcher units per model
+#define NUM_PRUNE_RATIOS 7           // pruning ratios of the sparse accuracy report
 
-int read_data_from_file(const char *path, int num_features, int label_size, float input_data[MAX_SAMPLES][MAX_FEATURES], float true_value[MAX_SAMPLES]) {
-    FILE *file = fopen(path, "r");
-    if (!file) {
-        perror("Failed to open file");
-        return -1;
+_Static_assert(BATCH_SIZE <= MAX_SAMPLES, "forward_batch() takes at most MAX_SAMPLES samples");
+
+// Layers pruned at each ratio of the report, and at the ratio of the tables of forward_batch_sparse()
+static const double prune_ratios[NUM_PRUNE_RATIOS] = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.7};
+static SparseLayer pruned_layers[NUM_PRUNE_RATIOS][MLP_NUM_LAYERS];
+static SparseLayer exported_layers[MLP_NUM_LAYERS];
+
+// Running totals over all the batches
+typedef struct {
+    long samples;
+    long correct;
+    long pool_correct;
+    long quantized_correct;
+    long quantized_agreements;
+    long pruned_correct[NUM_PRUNE_RATIOS];
+    long pruned_agreements[NUM_PRUNE_RATIOS];
+} Totals;
+
+// Runs all the checks of the testbench on one batch of the dataset
+// Returns 0 if the batch passes, 1 otherwise.
+static int check_batch(const DatasetBatch *batch, InferencePool *pool, Dispatcher *dispatcher, Totals *totals) {
+    const float (*input_data)[MAX_FEATURES] = (const float (*)[MAX_FEATURES])batch->samples;
+    int count = batch->count;
+
+    // classify the batch with a single batched call
+    int predictions[BATCH_SIZE];
+    forward_batch(batch->samples, count, predictions);
+
+    for (int i = 0; i < count; i++) {
+        int prediction = predictions[i];
+        if (prediction != forward(input_data[i][0], input_data[i][1], input_data[i][2], input_data[i][3])) {
+            printf("Batched and single-sample forward disagree on sample %ld\n", batch->first + i);
+            return 1;
+        }
+        if (prediction == batch->labels[i]) {
+            totals->correct++;
+        }else{
+            printf("Prediction: %d, True value: %d for input: %f %f %f %f\n", prediction, batch->labels[i], input_data[i][0], input_data[i][1], input_data[i][2], input_data[i][3]);
+        }
+    }
+
+    // the top-k output stage must rank the predicted class first, and keep only the classes
+    // reaching the confidence threshold
+    ClassScore top[BATCH_SIZE][MLP_TOP_K];
+    forward_batch_topk(batch->samples, count, -INFINITY, &top[0][0]);
+    for (int i = 0; i < count; i++) {
+        ClassScore single[MLP_TOP_K];
+        float threshold = top[i][0].score;
+        if (top[i][0].label != predictions[i] || forward_topk(input_data[i], threshold, single) < 1 ||
+            single[0].label != predictions[i] || forward_topk(input_data[i], threshold + 1.0f, single) != 0) {
+            printf("Top-k output and forward_batch disagree on sample %ld\n", batch->first + i);
+            return 1;
+        }
+        for (int k = 1; k < MLP_TOP_K; k++) {
+            if (top[i][k].score > top[i][k - 1].score) {
+                printf("Top-k output not sorted on sample %ld\n", batch->first + i);
+                return 1;
+            }
+        }
+    }
+
+    // the multi-unit top function must give the same predictions, in the same order, and reject
+    // batches larger than its unit buffers
+    int dispatch_predictions[BATCH_SIZE];
+    if (forward_dispatch(batch->samples, count, dispatch_predictions) != 0 ||
+        forward_dispatch(batch->samples, MAX_SAMPLES + 1, dispatch_predictions) != -1) {
+        printf("forward_dispatch does not check the batch size\n");
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (dispatch_predictions[i] != predictions[i]) {
+            printf("forward_dispatch and forward_batch disagree on sample %ld\n", batch->first + i);
+            return 1;
+        }
+    }
+
+    // serve the batch through the host dispatcher, alternating between the reference and the SIMD
+    // model: the results must come back in submission order with the forward_batch predictions
+    for (int i = 0; i < count; i++) {
+        dispatcher_submit(dispatcher, i % 2, input_data[i]);
+    }
+    long sequence;
+    int prediction;
+    for (int i = 0; dispatcher_result(dispatcher, &sequence, &prediction) == 0; i++) {
+        if (sequence != totals->samples + i || prediction != predictions[i]) {
+            printf("Dispatcher result %ld out of order or wrong for sample %ld\n", sequence, batch->first + i);
+            return 1;
+        }
+    }
+
+    // classify the batch again on the host worker pool, it must give the same predictions
+    int pool_predictions[BATCH_SIZE];
+    InferenceBatch pool_batch = {
+        .samples = batch->samples,
+        .sample_size = sizeof(input_data[0]),
+        .count = count,
+        .labels = batch->labels,
+        .predictions = pool_predictions
+    };
+    totals->pool_correct += inference_pool_run(pool, &pool_batch);
+    for (int i = 0; i < count; i++) {
+        if (pool_predictions[i] != predictions[i]) {
+            printf("Worker pool and forward_batch disagree on sample %ld\n", batch->first + i);
+            return 1;
+        }
+    }
+
+    // the vectorized CPU kernels must give the same predictions at every supported SIMD level
+    for (int level = simd_detect(); level >= SIMD_SCALAR; level--) {
+        simd_set_level((SimdLevel)level);
+        for (int i = 0; i < count; i++) {
+            if (mlp_forward_simd(input_data[i]) != predictions[i]) {
+                printf("SIMD (%s) and forward_batch disagree on sample %ld\n", simd_level_name(level), batch->first + i);
+                return 1;
+            }
+        }
+    }
+    simd_set_level(simd_detect());
+
+    // run the quantized path on the same samples and compare it with the float one
+    for (int i = 0; i < count; i++) {
+        int prediction = forward_quantized(input_data[i][0], input_data[i][1], input_data[i][2], input_data[i][3]);
+        if (prediction == batch->labels[i]) {
+            totals->quantized_correct++;
+        }
+        if (prediction == predictions[i]) {
+            totals->quantized_agreements++;
+        }
     }
 
-    int sample_count = 0;
-    while (fscanf(file, "%f", &input_data[sample_count][0]) != EOF) {
-        for (int i = 1; i < num_features; i++) {
-            fscanf(file, "%f", &input_data[sample_count][i]);
+    // classify the batch on the pruned layers of the report: without pruning the sparse kernel must
+    // give the forward_batch predictions, and the sparse top function must give the predictions of
+    // the host sparse kernel at the exported ratio
+    int sparse_predictions[BATCH_SIZE];
+    forward_batch_sparse(batch->samples, count, sparse_predictions);
+    for (int i = 0; i < count; i++) {
+        for (int r = 0; r < NUM_PRUNE_RATIOS; r++) {
+            int prediction = mlp_forward_sparse(input_data[i], pruned_layers[r]);
+            if (prediction == batch->labels[i]) {
+                totals->pruned_correct[r]++;
+            }
+            if (prediction == predictions[i]) {
+                totals->pruned_agreements[r]++;
+            }
+            if (prune_ratios[r] == 0.0 && prediction != predictions[i]) {
+                printf("Unpruned sparse layers and forward_batch disagree on sample %ld\n", batch->first + i);
+                return 1;
+            }
         }
-        for (int j = 0; j < label_size; j++) {
-            fscanf(file, "%f", &true_value[sample_count]);
+        if (sparse_predictions[i] != mlp_forward_sparse(input_data[i], exported_layers)) {
+            printf("forward_batch_sparse and the host sparse kernel disagree on sample %ld\n", batch->first + i);
+            return 1;
         }
-        sample_count++;
-        if (sample_count >= MAX_SAMPLES) {
-            break;
+    }
+
+    // the exported binary weights must give the same predictions, both memory-mapped on the host
+    // and loaded through the reloadable-weights top function
+    if (mlp_map_weights(WEIGHTS_PATH) != 0) {
+        return 1;
+    }
+    int mapped_predictions[BATCH_SIZE];
+    int reloaded_predictions[BATCH_SIZE];
+    forward_batch(batch->samples, count, mapped_predictions);
+    forward_batch_weights((const float *)mlp_params, 1, batch->samples, count, reloaded_predictions);
+    mlp_unmap_weights();
+    for (int i = 0; i < count; i++) {
+        if (mapped_predictions[i] != predictions[i] || reloaded_predictions[i] != predictions[i]) {
+            printf("Binary weights and compiled-in weights disagree on sample %ld\n", batch->first + i);
+            return 1;
         }
     }
 
-    fclose(file);
-    return sample_count;
+    totals->samples += count;
+    return 0;
 }
 
 int main() {
-    float input_data[MAX_SAMPLES][MAX_FEATURES];
-    float true_value[MAX_SAMPLES];
-
-    // Read data from file
-    const char *path = "./datasets/iris_dataset/iris_dataset_encoded.txt";
-    int sample_count = read_data_from_file(path, MAX_FEATURES, 1, input_data, true_value);
-    //sample_count = 3;
-    
-    // call the forward function for all the samples, and calculate the accuracy
-    int correct_predictions = 0;
-    for (int i = 0; i < sample_count; i++) {
-        int prediction = forward(input_data[i][0], input_data[i][1], input_data[i][2], input_data[i][3]);
-        if (prediction == true_value[i]) {
-            correct_predictions++;
-        }else{
-            printf("Prediction: %d, True value: %f for input: %f %f %f %f\n", prediction, true_value[i], input_data[i][0], input_data[i][1], input_data[i][2], input_data[i][3]);
+#ifdef MLP_EXTERNAL_WEIGHTS
+    // no weights compiled in: load them before the first forward pass, as the host of the FPGA would
+    if (mlp_load_weights(WEIGHTS_PATH) != 0) {
+        return 1;
+    }
+#endif
+    // the dataset is parsed in the background while the previous batches are classified
+    DatasetReader *reader = dataset_open(DATASET_PATH, DATASET_TABLE, MAX_FEATURES, 1, BATCH_SIZE);
+    if (!reader) {
+        return 1;
+    }
+    InferencePool *pool = inference_pool_create(0, mlp_classify_sample, 0);
+    DispatcherModel models[] = {
+        {mlp_classify_sample, DISPATCH_UNITS, 0},
+        {mlp_classify_sample_simd, DISPATCH_UNITS, 0}
+    };
+    Dispatcher *dispatcher = dispatcher_create(models, 2, BATCH_SIZE);
+    if (!pool || !dispatcher) {
+        inference_pool_destroy(pool);
+        dispatcher_destroy(dispatcher);
+        dataset_close(reader);
+        return 1;
+    }
+
+    for (int r = 0; r < NUM_PRUNE_RATIOS; r++) {
+        if (mlp_prune(prune_ratios[r], pruned_layers[r]) != 0) {
+            return 1;
         }
     }
-    float accuracy = (float)correct_predictions / sample_count * 100.0;
+    if (mlp_prune(mlp_sparse_ratio, exported_layers) != 0) {
+        return 1;
+    }
+
+    Totals totals = {0};
+    int failed = 0;
+    const DatasetBatch *batch;
+    while (!failed && (batch = dataset_next(reader)) != NULL) {
+        failed = check_batch(batch, pool, dispatcher, &totals);
+        dataset_release(reader, batch);
+    }
+    failed |= dataset_failed(reader);
+    int threads = inference_pool_threads(pool);
+    long unit_requests[2][DISPATCH_UNITS];
+    for (int m = 0; m < 2; m++) {
+        for (int u = 0; u < DISPATCH_UNITS; u++) {
+            unit_requests[m][u] = dispatcher_unit_requests(dispatcher, m, u);
+        }
+    }
+    inference_pool_destroy(pool);
+    dispatcher_destroy(dispatcher);
+    dataset_close(reader);
+    if (failed || totals.samples == 0) {
+        return 1;
+    }
+
+    float accuracy = (float)totals.correct / totals.samples * 100.0;
     printf("Accuracy: %.2f%%\n", accuracy);
+    printf("Worker pool (%d threads): %ld/%ld correct\n", threads, totals.pool_correct, totals.samples);
+    printf("Top-%d output matches\n", MLP_TOP_K);
+    printf("forward_dispatch (%d units) predictions match\n", MLP_DISPATCH_UNITS);
+    printf("Dispatcher results in order, requests per unit: reference %ld/%ld, simd %ld/%ld\n",
+           unit_requests[0][0], unit_requests[0][1], unit_requests[1][0], unit_requests[1][1]);
+    for (int level = simd_detect(); level >= SIMD_SCALAR; level--) {
+        printf("SIMD (%s) predictions match\n", simd_level_name(level));
+    }
+
+    float quantized_accuracy = (float)totals.quantized_correct / totals.samples * 100.0;
+    printf("Quantized accuracy: %.2f%% (agrees with float on %ld/%ld samples)\n", quantized_accuracy, totals.quantized_agreements, totals.samples);
+    if (accuracy - quantized_accuracy >= 1.0f) {
+        printf("Quantized accuracy loss exceeds 1%%\n");
+        return 1;
+    }
+    printf("Binary weights predictions match\n");
+
+    // accuracy of the magnitude-pruned network against the share of weights (and MACs) kept, and
+    // how often it agrees with the dense network
+    printf("Pruning ratio vs accuracy:\n");
+    printf("%6s %12s %9s %9s\n", "ratio", "weights", "accuracy", "agrees");
+    for (int r = 0; r < NUM_PRUNE_RATIOS; r++) {
+        int kept = 0;
+        int total = 0;
+        for (int l = 0; l < MLP_NUM_LAYERS; l++) {
+            kept += pruned_layers[r][l].nnz;
+            total += pruned_layers[r][l].rows * pruned_layers[r][l].cols;
+        }
+        printf("%5.0f%% %5d/%-6d %8.2f%% %8.2f%%\n", prune_ratios[r] * 100, kept, total,
+               (float)totals.pruned_correct[r] / totals.samples * 100.0,
+               (float)totals.pruned_agreements[r] / totals.samples * 100.0);
+        mlp_sparse_free(pruned_layers[r]);
+    }
+    mlp_sparse_free(exported_layers);
+    printf("forward_batch_sparse (ratio %g) predictions match\n", mlp_sparse_ratio);
+
+#ifdef MLP_PROFILE
+    // Every sample run through a layer must have counted its MACs; stalls are only counted on the FPGA
+#define MLP_LAYER_MACS(name, source, n_in, n_out, activation) (n_in) * (n_out),
+    static const uint64_t layer_macs[MLP_NUM_LAYERS] = {MLP_LAYERS(MLP_LAYER_MACS)};
+    LayerCounters counters[MLP_NUM_LAYERS];
+    mlp_profile_read(counters);
+    mlp_profile_print(stdout);
+    for (int l = 0; l < MLP_NUM_LAYERS; l++) {
+        if (counters[l].calls == 0 || counters[l].calls != counters[0].calls || counters[l].macs != counters[l].calls * layer_macs[l] ||
+            counters[l].stall_cycles != 0) {
+            printf("Profiling counters are inconsistent\n");
+            return 1;
+        }
+    }
+#endif
+    return 0;
 }
@@ -0,0 +1,303 @@
+#include "benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DISTINCT_SAMPLES 4096        // synthetic inputs, reused cyclically
+#define REPORT_SIZE 2048
+
+typedef struct {
+    double p50;
+    double p99;
+    double mean;
+    double samples_per_second;
+    double gflops;
+} BenchmarkResult;
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "Usage: %s [--samples N] [--batch N] [--threads N] [--warmup N] [--kernel NAME]\n"
+            "          [--output FILE] [--baseline FILE] [--tolerance PERCENT]\n"
+            "  --threads 1 runs in the calling thread, 0 uses one worker per CPU\n",
+            program);
+}
+
+int benchmark_parse_args(int argc, char **argv, BenchmarkConfig *config) {
+    config->samples = 100000;
+    config->batch_size = 64;
+    config->threads = 1;
+    config->warmup = 10;
+    config->kernel = NULL;
+    config->output = NULL;
+    config->baseline = NULL;
+    config->tolerance = 10.0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!value) {
+            usage(argv[0]);
+            return -1;
+        }
+        if (strcmp(argv[i], "--samples") == 0) {
+            config->samples = atol(value);
+        } else if (strcmp(argv[i], "--batch") == 0) {
+            config->batch_size = atoi(value);
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            config->threads = atoi(value);
+        } else if (strcmp(argv[i], "--warmup") == 0) {
+            config->warmup = atoi(value);
+        } else if (strcmp(argv[i], "--kernel") == 0) {
+            config->kernel = value;
+        } else if (strcmp(argv[i], "--output") == 0) {
+            config->output = value;
+        } else if (strcmp(argv[i], "--baseline") == 0) {
+            config->baseline = value;
+        } else if (strcmp(argv[i], "--tolerance") == 0) {
+            config->tolerance = atof(value);
+        } else {
+            usage(argv[0]);
+            return -1;
+        }
+        i++;
+    }
+    if (config->samples <= 0 || config->batch_size <= 0 || config->threads < 0 || config->warmup < 0 ||
+        config->tolerance < 0) {
+        usage(argv[0]);
+        return -1;
+    }
+    return 0;
+}
+
+static double now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted values
+static double percentile(const double *sorted, long count, double p) {
+    long rank = (long)(p / 100.0 * count + 0.999999);
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[(rank > count ? count : rank) - 1];
+}
+
+/*---------------------------- Baseline ----------------------------*/
+
+// Reads the number following "key": in a report, -1 if missing
+static double json_number(const char *json, const char *key) {
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char *p = strstr(json, pattern);
+    return p ? strtod(p + strlen(pattern), NULL) : -1.0;
+}
+
+// Checks that the string following "key": is value
+static int json_string_is(const char *json, const char *key, const char *value) {
+    char pattern[128];
+    snprintf(pattern, sizeof(pattern), "\"%s\": \"%s\"", key, value);
+    return strstr(json, pattern) != NULL;
+}
+
+static char *read_file(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        perror("Failed to open baseline");
+        return NULL;
+    }
+    char *text = calloc(1, REPORT_SIZE + 1);
+    if (text && fread(text, 1, REPORT_SIZE, file) == 0) {
+        fprintf(stderr, "Failed to read baseline %s\n", path);
+        free(text);
+        text = NULL;
+    }
+    fclose(file);
+    return text;
+}
+
+/*----------------------------- Runs -----------------------------*/
+
+// Fills the synthetic inputs with a fixed-seed LCG, so every run sees the same data
+static void make_inputs(const BenchmarkTarget *target, float *inputs, long count) {
+    unsigned int state = 12345u;
+    float range = target->input_max - target->input_min;
+    for (long i = 0; i < count * target->sample_floats; i++) {
+        state = state * 1664525u + 1013904223u;
+        inputs[i] = target->input_min + range * (float)(state >> 8) / (float)(1u << 24);
+    }
+}
+
+static const BenchmarkKernel *find_kernel(const BenchmarkTarget *target, const char *name) {
+    if (!name) {
+        return &target->kernels[0];
+    }
+    for (int k = 0; k < target->num_kernels; k++) {
+        if (strcmp(target->kernels[k].name, name) == 0) {
+            return &target->kernels[k];
+        }
+    }
+    fprintf(stderr, "Unknown kernel %s, available:", name);
+    for (int k = 0; k < target->num_kernels; k++) {
+        fprintf(stderr, " %s", target->kernels[k].name);
+    }
+    fprintf(stderr, "\n");
+    return NULL;
+}
+
+int benchmark_run(const BenchmarkTarget *target, const BenchmarkConfig *config) {
+    const BenchmarkKernel *kernel = find_kernel(target, config->kernel);
+    if (!kernel) {
+        return 1;
+    }
+
+    int batch_size = config->batch_size;
+    if (kernel->classify_batch && (config->threads != 1 || batch_size > kernel->max_batch)) {
+        fprintf(stderr, "Kernel %s runs whole batches of at most %d samples in the calling thread: "
+                "use --threads 1 and --batch %d or less\n", kernel->name, kernel->max_batch, kernel->max_batch);
+        return 1;
+    }
+    long num_batches = (config->samples + batch_size - 1) / batch_size;
+    // whole batches of distinct inputs, at least one
+    long distinct = DISTINCT_SAMPLES / batch_size * batch_size;
+    if (distinct < batch_size) {
+        distinct = batch_size;
+    }
+    size_t sample_size = sizeof(float) * target->sample_floats;
+
+    float *inputs = malloc(sample_size * distinct);
+    int *predictions = malloc(sizeof(int) * batch_size);
+    double *latencies = malloc(sizeof(double) * num_batches);
+    void *scratch = kernel->scratch_size ? malloc(kernel->scratch_size) : NULL;
+    InferencePool *pool = config->threads != 1 ? inference_pool_create(config->threads, kernel->classify, kernel->scratch_size) : NULL;
+    if (!inputs || !predictions || !latencies || (kernel->scratch_size && !scratch) || (config->threads != 1 && !pool)) {
+        perror("Failed to set up the benchmark");
+        free(inputs);
+        free(predictions);
+        free(latencies);
+        free(scratch);
+        inference_pool_destroy(pool);
+        return 1;
+    }
+    make_inputs(target, inputs, distinct);
+    int threads = pool ? inference_pool_threads(pool) : 1;
+
+    long sample_index = 0;
+    long remaining = config->samples;
+    double total_us = 0;
+    for (long b = -config->warmup; b < num_batches; b++) {
+        int count = b < 0 || remaining >= batch_size ? batch_size : (int)remaining;
+        const char *samples = (const char *)inputs + sample_index * sample_size;
+        sample_index = (sample_index + batch_size) % distinct;
+
+        double start = now_us();
+        int failed = 0;
+        if (kernel->classify_batch) {
+            failed = kernel->classify_batch(samples, count, predictions, scratch) != 0;
+        } else if (pool) {
+            InferenceBatch batch = {
+                .samples = samples,
+                .sample_size = sample_size,
+                .count = count,
+                .labels = NULL,
+                .predictions = predictions
+            };
+            inference_pool_run(pool, &batch);
+        } else {
+            for (int i = 0; i < count; i++) {
+                predictions[i] = kernel->classify(samples + i * sample_size, scratch);
+            }
+        }
+        double elapsed = now_us() - start;
+        if (failed) {
+            fprintf(stderr, "Kernel %s failed on a batch of %d samples\n", kernel->name, count);
+            free(inputs);
+            free(predictions);
+            free(latencies);
+            free(scratch);
+            return 1;
+        }
+
+        if (b >= 0) {
+            latencies[b] = elapsed;
+            total_us += elapsed;
+            remaining -= count;
+        }
+    }
+
+    qsort(latencies, num_batches, sizeof(double), compare_doubles);
+    BenchmarkResult result = {
+        .p50 = percentile(latencies, num_batches, 50),
+        .p99 = percentile(latencies, num_batches, 99),
+        .mean = total_us / num_batches,
+        .samples_per_second = config->samples / (total_us * 1e-6),
+    };
+    result.gflops = result.samples_per_second * target->flops_per_sample * 1e-9;
+
+    char report[REPORT_SIZE];
+    int length = snprintf(report, sizeof(report),
+                          "{\"network\": \"%s\", \"kernel\": \"%s\", \"samples\": %ld, \"batch_size\": %d, \"threads\": %d,\n"
+                          " \"latency_us\": {\"p50\": %.3f, \"p99\": %.3f, \"mean\": %.3f}, \"samples_per_second\": %.1f,\n"
+                          " \"gflops\": %.4f",
+                          target->network, kernel->name, config->samples, batch_size, threads,
+                          result.p50, result.p99, result.mean, result.samples_per_second, result.gflops);
+
+    int status = 0;
+    if (config->baseline) {
+        char *baseline = read_file(config->baseline);
+        if (!baseline) {
+            status = 1;
+        } else if (!json_string_is(baseline, "network", target->network) ||
+                   !json_string_is(baseline, "kernel", kernel->name) ||
+                   json_number(baseline, "batch_size") != batch_size || json_number(baseline, "threads") != threads) {
+            fprintf(stderr, "%s: baseline taken with a different network, kernel, batch size or thread count\n",
+                    config->baseline);
+            status = 1;
+        } else {
+            double base_throughput = json_number(baseline, "samples_per_second");
+            double base_p50 = json_number(baseline, "p50");
+            double throughput_change = (result.samples_per_second / base_throughput - 1.0) * 100.0;
+            double p50_change = (result.p50 / base_p50 - 1.0) * 100.0;
+            int regression = throughput_change < -config->tolerance || p50_change > config->tolerance;
+            length += snprintf(report + length, sizeof(report) - length,
+                               ",\n \"baseline\": {\"samples_per_second\": %.1f, \"p50\": %.3f,"
+                               " \"throughput_change_pct\": %.2f, \"p50_change_pct\": %.2f,"
+                               " \"tolerance_pct\": %.2f, \"regression\": %s}",
+                               base_throughput, base_p50, throughput_change, p50_change, config->tolerance,
+                               regression ? "true" : "false");
+            if (regression) {
+                fprintf(stderr, "Regression: throughput %+.2f%%, p50 latency %+.2f%% (tolerance %.2f%%)\n",
+                        throughput_change, p50_change, config->tolerance);
+                status = 2;
+            }
+        }
+        free(baseline);
+    }
+    snprintf(report + length, sizeof(report) - length, "}\n");
+
+    fputs(report, stdout);
+    if (config->output) {
+        FILE *file = fopen(config->output, "w");
+        if (!file || fputs(report, file) == EOF) {
+            perror("Failed to write the report");
+            status = status ? status : 1;
+        }
+        if (file) {
+            fclose(file);
+        }
+    }
+
+    free(inputs);
+    free(predictions);
+    free(latencies);
+    free(scratch);
+    inference_pool_destroy(pool);
+    return status;
+}
@@ -0,0 +1,68 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stddef.h>
+#include "inference_pool.h"
+
+// Host-only benchmark harness shared by MLP/benchmark.c and ConvNet/benchmark.c.
+//
+// Classifies a stream of synthetic samples in batches, one timed call per batch, either in the
+// calling thread (threads = 1) or on the inference pool, and prints a JSON report:
+//
+//   {"network": "mlp", "kernel": "reference", "samples": 100000, "batch_size": 64, "threads": 1,
+//    "latency_us": {"p50": 12.3, "p99": 15.1, "mean": 12.6}, "samples_per_second": 5.1e6,
+//    "gflops": 1.73}
+//
+// Per-sample kernels classify a batch one sample at a time (or spread over the pool); batch
+// kernels make one call of a batched entry point (forward_batch(), forward_dispatch()) per batch,
+// in the calling thread.
+// latency_us is the wall time of one batch. With --baseline, the report is compared with a stored
+// one and the run fails when the throughput or the p50 latency is worse by more than the tolerance.
+
+#define BENCHMARK_MAX_KERNELS 8
+
+/*------------------------ Data Structures ------------------------*/
+
+// Classifies count samples with one call; scratch as for ClassifyFn. Returns 0 on success.
+typedef int (*ClassifyBatchFn)(const void *samples, int count, int *predictions, void *scratch);
+
+typedef struct {
+    const char *name;            // value of --kernel
+    ClassifyFn classify;         // per-sample kernel, NULL for a batch kernel
+    size_t scratch_size;         // scratch bytes needed by classify or classify_batch
+    ClassifyBatchFn classify_batch; // batch kernel, NULL for a per-sample kernel
+    int max_batch;               // largest count taken by classify_batch
+} BenchmarkKernel;
+
+typedef struct {
+    const char *network;         // name in the report
+    int sample_floats;           // floats per sample
+    float input_min;             // range of the synthetic input values
+    float input_max;
+    double flops_per_sample;     // floating-point operations of one forward pass (2 per MAC)
+    BenchmarkKernel kernels[BENCHMARK_MAX_KERNELS]; // the first one is the default
+    int num_kernels;
+} BenchmarkTarget;
+
+typedef struct {
+    long samples;                // samples classified in the timed runs
+    int batch_size;              // samples per timed call
+    int threads;                 // 1: calling thread, 0: one worker per CPU, N: N workers
+    int warmup;                  // untimed batches run first
+    const char *kernel;          // NULL for the default one
+    const char *output;          // also write the report to this file
+    const char *baseline;        // compare with this report
+    double tolerance;            // allowed slowdown against the baseline, in percent
+} BenchmarkConfig;
+
+/*-------------------------- Functions ---------------------------*/
+
+// Parses --samples, --batch, --threads, --warmup, --kernel, --output, --baseline, --tolerance
+// Returns 0 on success, -1 after printing the usage.
+int benchmark_parse_args(int argc, char **argv, BenchmarkConfig *config);
+
+// Runs the benchmark and prints the report on stdout
+// Returns 0 on success, 1 on errors, 2 on a regression against the baseline.
+int benchmark_run(const BenchmarkTarget *target, const BenchmarkConfig *config);
+
+#endif // BENCHMARK_H
@@ -0,0 +1,447 @@
+#include "dataset_reader.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CHUNK_SIZE (4 << 20)         // parsed bytes between two releases of the mapped pages
+#define MAX_TOKEN 64                 // longest number copied to the stack for strtof(), longer ones are heap-copied
+#define MAX_PATH 256
+
+struct DatasetReader {
+    DatasetFormat format;
+    int sample_size;
+    int label_columns;
+    int batch_size;
+    char path[MAX_PATH];             // for the error messages
+
+    char *map;                       // whole file mapping
+    size_t map_size;
+    const char *pos;                 // parser position
+    const char *end;
+    const char *chunk_start;         // first mapped byte not released yet
+    long next_sample;                // index of the next sample to parse
+
+    DatasetBatch slots[DATASET_RING_SIZE];
+    float *sample_storage;           // backing memory of the slots
+    int *label_storage;
+
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t slot_free;        // the caller released a batch (or the reader is closing)
+    pthread_cond_t slot_ready;       // the parser filled a batch (or reached the end)
+    unsigned long produced;          // batches filled by the parser
+    unsigned long consumed;          // batches returned by dataset_next()
+    unsigned long released;          // batches given back by dataset_release()
+    int done;                        // the parser will not produce more batches
+    int failed;
+    int shutdown;
+};
+
+/*------------------------- Number parsing -------------------------*/
+
+// Bounds of the fast path of parse_float()
+#define FAST_PATH_DIGITS 9
+#define FAST_PATH_EXPONENT 10
+
+static const double powers_of_ten[FAST_PATH_EXPONENT + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+};
+
+static int is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Characters that end a number in both formats
+static int is_separator(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' || c == '{' || c == '}';
+}
+
+// Converts the raw token at *cursor (up to the next separator) with strtof(): the numbers outside
+// the fast path, including nan, inf, hexadecimal and tokens longer than MAX_TOKEN
+static int parse_float_strtof(const char **cursor, const char *end, float *value) {
+    const char *start = *cursor;
+    const char *token_end = start;
+    while (token_end < end && !is_separator(*token_end)) {
+        token_end++;
+    }
+
+    char buffer[MAX_TOKEN];
+    size_t length = (size_t)(token_end - start);
+    char *token = length < sizeof(buffer) ? buffer : malloc(length + 1);
+    if (token == NULL) {
+        return -1;
+    }
+    memcpy(token, start, length);
+    token[length] = '\0';
+    char *stop;
+    *value = strtof(token, &stop);
+    size_t used = (size_t)(stop - token);
+    if (token != buffer) {
+        free(token);
+    }
+    if (used == 0) {
+        return -1;
+    }
+    *cursor = start + used;
+    return 0;
+}
+
+// Parses a decimal number ([sign] digits [. digits] [e [sign] digits]) without reading past end.
+// Numbers with at most 9 significant digits scaled by at most 10^10, which covers the datasets,
+// are converted with one double operation, rounded to float: the double result is close enough to
+// the exact value that this gives the same float as strtof(). With more digits the double rounding
+// can differ from strtof() in the last bit, so the others go through strtof(), as do the tokens the
+// decimal syntax does not cover (nan, inf, hexadecimal).
+static int parse_float(const char **cursor, const char *end, float *value) {
+    const char *start = *cursor;
+    const char *p = start;
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;                  // significant digits in mantissa
+    int exponent = 0;
+    int seen_digit = 0;
+    int exact = 1;
+    for (; p < end && is_digit(*p); p++) {
+        seen_digit = 1;
+        if (digits < 15) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits += mantissa != 0;
+        } else {
+            exponent++;
+            exact &= *p == '0';
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && is_digit(*p); p++) {
+            seen_digit = 1;
+            if (digits < 15) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                digits += mantissa != 0;
+                exponent--;
+            } else {
+                exact &= *p == '0';
+            }
+        }
+    }
+    if (!seen_digit) {
+        return parse_float_strtof(cursor, end, value);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        int exponent_negative = 0;
+        if (q < end && (*q == '-' || *q == '+')) {
+            exponent_negative = *q == '-';
+            q++;
+        }
+        if (q < end && is_digit(*q)) {
+            int e = 0;
+            for (; q < end && is_digit(*q); q++) {
+                if (e < 10000) {
+                    e = e * 10 + (*q - '0');
+                }
+            }
+            exponent += exponent_negative ? -e : e;
+            p = q;
+        }
+    }
+    if (p < end && !is_separator(*p)) {
+        return parse_float_strtof(cursor, end, value);
+    }
+
+    if (exact && digits <= FAST_PATH_DIGITS && exponent >= -FAST_PATH_EXPONENT && exponent <= FAST_PATH_EXPONENT) {
+        // mantissa < 10^9 and the power of ten are exact doubles
+        double result = (double)mantissa;
+        result = exponent < 0 ? result / powers_of_ten[-exponent] : result * powers_of_ten[exponent];
+        *value = (float)(negative ? -result : result);
+        *cursor = p;
+        return 0;
+    }
+    return parse_float_strtof(cursor, end, value);
+}
+
+/*-------------------------- Sample parsing -------------------------*/
+
+static void skip_whitespace(DatasetReader *reader) {
+    while (reader->pos < reader->end &&
+           (*reader->pos == ' ' || *reader->pos == '\t' || *reader->pos == '\r' || *reader->pos == '\n')) {
+        reader->pos++;
+    }
+}
+
+// Skips whitespace and the ',', '{' and '}' around the pixel values of DATASET_IMAGES
+static void skip_separators(DatasetReader *reader) {
+    while (reader->pos < reader->end) {
+        char c = *reader->pos;
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n' && c != ',' && c != '{' && c != '}') {
+            break;
+        }
+        reader->pos++;
+    }
+}
+
+static int parse_error(DatasetReader *reader, const char *what) {
+    fprintf(stderr, "%s: sample %ld (byte %ld): %s\n", reader->path, reader->next_sample,
+            (long)(reader->pos - reader->map), what);
+    return -1;
+}
+
+// Parses one DATASET_TABLE sample; returns 1 if parsed, 0 at the end of the file, -1 on error
+static int parse_table_sample(DatasetReader *reader, float *sample, int *label) {
+    skip_whitespace(reader);
+    if (reader->pos == reader->end) {
+        return 0;
+    }
+    for (int i = 0; i < reader->sample_size; i++) {
+        skip_whitespace(reader);
+        if (parse_float(&reader->pos, reader->end, &sample[i]) != 0) {
+            return parse_error(reader, "expected a feature value");
+        }
+    }
+    for (int j = 0; j < reader->label_columns; j++) {
+        float value;
+        skip_whitespace(reader);
+        if (parse_float(&reader->pos, reader->end, &value) != 0) {
+            return parse_error(reader, "expected a label value");
+        }
+        if (j == 0) {
+            *label = (int)value;
+        }
+    }
+    return 1;
+}
+
+// Parses one DATASET_IMAGES sample; returns 1 if parsed, 0 at the end of the file, -1 on error
+static int parse_image_sample(DatasetReader *reader, float *sample, int *label) {
+    static const char keyword[] = "Label:";
+    const size_t keyword_length = sizeof(keyword) - 1;
+
+    skip_separators(reader);
+    if (reader->pos == reader->end) {
+        return 0;
+    }
+    if ((size_t)(reader->end - reader->pos) < keyword_length || memcmp(reader->pos, keyword, keyword_length) != 0) {
+        return parse_error(reader, "expected \"Label:\"");
+    }
+    reader->pos += keyword_length;
+    skip_whitespace(reader);
+    float value;
+    if (parse_float(&reader->pos, reader->end, &value) != 0) {
+        return parse_error(reader, "expected the label");
+    }
+    *label = (int)value;
+
+    for (int i = 0; i < reader->sample_size; i++) {
+        skip_separators(reader);
+        if (parse_float(&reader->pos, reader->end, &sample[i]) != 0) {
+            return parse_error(reader, "expected a pixel value");
+        }
+    }
+    return 1;
+}
+
+// Drops the pages already parsed, so the resident size stays bounded on large files
+static void release_parsed_pages(DatasetReader *reader) {
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t parsed = (size_t)(reader->pos - reader->chunk_start);
+    if (parsed < CHUNK_SIZE) {
+        return;
+    }
+    size_t length = parsed / page_size * page_size;
+    madvise((void *)reader->chunk_start, length, MADV_DONTNEED);
+    reader->chunk_start += length;
+}
+
+// Fills one batch; returns the number of samples, or -1 on error
+static int fill_batch(DatasetReader *reader, DatasetBatch *batch) {
+    batch->first = reader->next_sample;
+    int count = 0;
+    while (count < reader->batch_size) {
+        float *sample = batch->samples + (size_t)count * reader->sample_size;
+        int result = reader->format == DATASET_TABLE ? parse_table_sample(reader, sample, &batch->labels[count])
+                                                     : parse_image_sample(reader, sample, &batch->labels[count]);
+        if (result < 0) {
+            return -1;
+        }
+        if (result == 0) {
+            break;
+        }
+        count++;
+        reader->next_sample++;
+    }
+    batch->count = count;
+    release_parsed_pages(reader);
+    return count;
+}
+
+/*----------------------------- Ring -----------------------------*/
+
+static void *parser_main(void *arg) {
+    DatasetReader *reader = arg;
+
+    for (;;) {
+        pthread_mutex_lock(&reader->lock);
+        while (!reader->shutdown && reader->produced - reader->released == DATASET_RING_SIZE) {
+            pthread_cond_wait(&reader->slot_free, &reader->lock);
+        }
+        int shutdown = reader->shutdown;
+        DatasetBatch *batch = &reader->slots[reader->produced % DATASET_RING_SIZE];
+        pthread_mutex_unlock(&reader->lock);
+        if (shutdown) {
+            break;
+        }
+
+        // the slot is owned by the parser until produced is incremented
+        int count = fill_batch(reader, batch);
+
+        pthread_mutex_lock(&reader->lock);
+        if (count > 0) {
+            reader->produced++;
+        }
+        if (count < reader->batch_size) {
+            reader->failed = count < 0;
+            reader->done = 1;
+        }
+        pthread_cond_signal(&reader->slot_ready);
+        int finished = reader->done;
+        pthread_mutex_unlock(&reader->lock);
+        if (finished) {
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&reader->lock);
+    reader->done = 1;
+    pthread_cond_signal(&reader->slot_ready);
+    pthread_mutex_unlock(&reader->lock);
+    return NULL;
+}
+
+DatasetReader *dataset_open(const char *path, DatasetFormat format, int sample_size, int label_columns, int batch_size) {
+    if (sample_size <= 0 || batch_size <= 0 || label_columns < 0 || (format == DATASET_TABLE && label_columns == 0)) {
+        fprintf(stderr, "%s: invalid dataset layout\n", path);
+        return NULL;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror("Failed to open dataset");
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        fprintf(stderr, "%s: empty or unreadable file\n", path);
+        close(fd);
+        return NULL;
+    }
+    char *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror("Failed to map dataset");
+        return NULL;
+    }
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    DatasetReader *reader = calloc(1, sizeof(DatasetReader));
+    float *sample_storage = malloc(sizeof(float) * DATASET_RING_SIZE * batch_size * (size_t)sample_size);
+    int *label_storage = malloc(sizeof(int) * DATASET_RING_SIZE * (size_t)batch_size);
+    if (!reader || !sample_storage || !label_storage) {
+        perror("Failed to allocate the dataset reader");
+        free(reader);
+        free(sample_storage);
+        free(label_storage);
+        munmap(map, (size_t)st.st_size);
+        return NULL;
+    }
+    reader->format = format;
+    reader->sample_size = sample_size;
+    reader->label_columns = label_columns;
+    reader->batch_size = batch_size;
+    snprintf(reader->path, sizeof(reader->path), "%s", path);
+    reader->map = map;
+    reader->map_size = (size_t)st.st_size;
+    reader->pos = map;
+    reader->end = map + st.st_size;
+    reader->chunk_start = map;
+    reader->sample_storage = sample_storage;
+    reader->label_storage = label_storage;
+    for (int i = 0; i < DATASET_RING_SIZE; i++) {
+        reader->slots[i].samples = sample_storage + (size_t)i * batch_size * sample_size;
+        reader->slots[i].labels = label_storage + (size_t)i * batch_size;
+    }
+    pthread_mutex_init(&reader->lock, NULL);
+    pthread_cond_init(&reader->slot_free, NULL);
+    pthread_cond_init(&reader->slot_ready, NULL);
+
+    if (pthread_create(&reader->thread, NULL, parser_main, reader) != 0) {
+        perror("Failed to start the dataset parser");
+        pthread_mutex_destroy(&reader->lock);
+        pthread_cond_destroy(&reader->slot_free);
+        pthread_cond_destroy(&reader->slot_ready);
+        free(sample_storage);
+        free(label_storage);
+        munmap(map, reader->map_size);
+        free(reader);
+        return NULL;
+    }
+    return reader;
+}
+
+const DatasetBatch *dataset_next(DatasetReader *reader) {
+    pthread_mutex_lock(&reader->lock);
+    while (reader->consumed == reader->produced && !reader->done) {
+        pthread_cond_wait(&reader->slot_ready, &reader->lock);
+    }
+    const DatasetBatch *batch = NULL;
+    if (reader->consumed < reader->produced) {
+        batch = &reader->slots[reader->consumed % DATASET_RING_SIZE];
+        reader->consumed++;
+    }
+    pthread_mutex_unlock(&reader->lock);
+    return batch;
+}
+
+void dataset_release(DatasetReader *reader, const DatasetBatch *batch) {
+    pthread_mutex_lock(&reader->lock);
+    if (reader->released == reader->consumed || batch != &reader->slots[reader->released % DATASET_RING_SIZE]) {
+        fprintf(stderr, "%s: batches must be released once, in order\n", reader->path);
+        abort();
+    }
+    reader->released++;
+    pthread_cond_signal(&reader->slot_free);
+    pthread_mutex_unlock(&reader->lock);
+}
+
+int dataset_failed(const DatasetReader *reader) {
+    // only meaningful once dataset_next() returned NULL, which synchronized with the parser
+    return reader->failed;
+}
+
+void dataset_close(DatasetReader *reader) {
+    if (!reader) {
+        return;
+    }
+    pthread_mutex_lock(&reader->lock);
+    reader->shutdown = 1;
+    pthread_cond_signal(&reader->slot_free);
+    pthread_mutex_unlock(&reader->lock);
+    pthread_join(reader->thread, NULL);
+
+    pthread_mutex_destroy(&reader->lock);
+    pthread_cond_destroy(&reader->slot_free);
+    pthread_cond_destroy(&reader->slot_ready);
+    free(reader->sample_storage);
+    free(reader->label_storage);
+    munmap(reader->map, reader->map_size);
+    free(reader);
+}
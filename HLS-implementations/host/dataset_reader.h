@@ -0,0 +1,52 @@
+#ifndef DATASET_READER_H
+#define DATASET_READER_H
+
+// Host-only streaming reader for the text datasets of the testbenches.
+//
+// The file is memory-mapped and parsed by a background thread into a fixed ring of
+// DATASET_RING_SIZE batches, allocated once when the reader is opened. The caller takes filled
+// batches with dataset_next(), runs inference on them and gives them back with dataset_release(),
+// while the parser fills the following ones. There is no per-sample allocation and no limit on
+// the number of samples; the pages already parsed are dropped from memory as the parser advances.
+
+#define DATASET_RING_SIZE 4          // batches in flight between the parser and the caller
+
+/*------------------------ Data Structures ------------------------*/
+
+typedef enum {
+    // One sample per line: sample_size features, then label_columns values, separated by
+    // whitespace (datasets/iris_dataset/iris_dataset_encoded.txt). The label is the first label column.
+    DATASET_TABLE,
+    // Images as written by mnist_convnet.ipynb, one after the other: "Label: <n>" followed by the
+    // pixel rows in braces, "{v,v,...,v},", sample_size values in total (pytorch/input_image.txt)
+    DATASET_IMAGES
+} DatasetFormat;
+
+typedef struct {
+    float *samples;              // count rows of sample_size floats
+    int *labels;                 // count labels
+    int count;                   // samples in the batch, 1 to batch_size
+    long first;                  // index of the first sample in the file
+} DatasetBatch;
+
+typedef struct DatasetReader DatasetReader;
+
+/*-------------------------- Functions ---------------------------*/
+
+// Maps path and starts parsing it in batches of batch_size samples
+// label_columns is only used by DATASET_TABLE. Returns NULL with a message on stderr on failure.
+DatasetReader *dataset_open(const char *path, DatasetFormat format, int sample_size, int label_columns, int batch_size);
+
+// Next batch in file order, waiting for the parser if needed
+// Returns NULL at the end of the file or after a parse error (see dataset_failed()).
+const DatasetBatch *dataset_next(DatasetReader *reader);
+
+// Gives a batch back to the parser; batches must be released in the order they were returned
+void dataset_release(DatasetReader *reader, const DatasetBatch *batch);
+
+// Non-zero if parsing stopped on an error
+int dataset_failed(const DatasetReader *reader);
+
+void dataset_close(DatasetReader *reader);
+
+#endif // DATASET_READER_H
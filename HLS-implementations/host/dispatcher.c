@@ -0,0 +1,202 @@
+#include "dispatcher.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CACHE_LINE 64
+
+typedef struct {
+    const void *sample;
+    int model;
+    int prediction;
+    int done;                    // prediction is valid
+} Request;
+
+typedef struct {
+    Dispatcher *dispatcher;
+    int model;
+    void *scratch;               // private scratch area
+    pthread_t thread;
+    long requests;               // requests completed, updated under the lock
+} Unit;
+
+typedef struct {
+    DispatcherModel config;
+    Unit *units;
+    int started;                 // units running
+    long *pending;               // FIFO of sequence numbers, queue_depth entries
+    long head;                   // pending[head % queue_depth] is the oldest request
+    long tail;
+    pthread_cond_t work_ready;   // a request was queued for this model (or shutdown)
+} ModelQueue;
+
+struct Dispatcher {
+    int num_models;
+    int queue_depth;
+    ModelQueue models[DISPATCHER_MAX_MODELS];
+    Request *requests;           // requests in flight, indexed by sequence % queue_depth
+
+    pthread_mutex_t lock;
+    pthread_cond_t result_ready; // a request completed
+    pthread_cond_t space_free;   // a result was retrieved
+    long submitted;
+    long retrieved;
+    int shutdown;
+};
+
+static void *unit_main(void *arg) {
+    Unit *unit = arg;
+    Dispatcher *dispatcher = unit->dispatcher;
+    ModelQueue *queue = &dispatcher->models[unit->model];
+
+    pthread_mutex_lock(&dispatcher->lock);
+    for (;;) {
+        while (!dispatcher->shutdown && queue->head == queue->tail) {
+            pthread_cond_wait(&queue->work_ready, &dispatcher->lock);
+        }
+        if (dispatcher->shutdown) {
+            break;
+        }
+        long sequence = queue->pending[queue->head % dispatcher->queue_depth];
+        queue->head++;
+        Request *request = &dispatcher->requests[sequence % dispatcher->queue_depth];
+        pthread_mutex_unlock(&dispatcher->lock);
+
+        int prediction = queue->config.classify(request->sample, unit->scratch);
+
+        pthread_mutex_lock(&dispatcher->lock);
+        request->prediction = prediction;
+        request->done = 1;
+        unit->requests++;
+        if (sequence == dispatcher->retrieved) {
+            pthread_cond_signal(&dispatcher->result_ready);
+        }
+    }
+    pthread_mutex_unlock(&dispatcher->lock);
+    return NULL;
+}
+
+Dispatcher *dispatcher_create(const DispatcherModel *models, int num_models, int queue_depth) {
+    if (num_models <= 0 || num_models > DISPATCHER_MAX_MODELS || queue_depth <= 0) {
+        fprintf(stderr, "Invalid dispatcher configuration\n");
+        return NULL;
+    }
+    Dispatcher *dispatcher = calloc(1, sizeof(Dispatcher));
+    if (!dispatcher) {
+        perror("Failed to allocate the dispatcher");
+        return NULL;
+    }
+    dispatcher->num_models = num_models;
+    dispatcher->queue_depth = queue_depth;
+    pthread_mutex_init(&dispatcher->lock, NULL);
+    pthread_cond_init(&dispatcher->result_ready, NULL);
+    pthread_cond_init(&dispatcher->space_free, NULL);
+    for (int m = 0; m < num_models; m++) {
+        pthread_cond_init(&dispatcher->models[m].work_ready, NULL);
+    }
+
+    dispatcher->requests = calloc(queue_depth, sizeof(Request));
+    int failed = !dispatcher->requests;
+    // round the scratch size up to whole cache lines so units never share one
+    for (int m = 0; m < num_models && !failed; m++) {
+        ModelQueue *queue = &dispatcher->models[m];
+        queue->config = models[m];
+        queue->pending = malloc(sizeof(long) * queue_depth);
+        queue->units = calloc(models[m].units > 0 ? models[m].units : 1, sizeof(Unit));
+        size_t scratch_bytes = (models[m].scratch_size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+        failed = !queue->pending || !queue->units || models[m].units <= 0;
+
+        // started only counts the units whose thread is running, dispatcher_destroy() joins them
+        for (; !failed && queue->started < models[m].units; queue->started++) {
+            Unit *unit = &queue->units[queue->started];
+            unit->dispatcher = dispatcher;
+            unit->model = m;
+            unit->scratch = scratch_bytes ? aligned_alloc(CACHE_LINE, scratch_bytes) : NULL;
+            if ((scratch_bytes && !unit->scratch) || pthread_create(&unit->thread, NULL, unit_main, unit) != 0) {
+                free(unit->scratch);
+                unit->scratch = NULL;
+                failed = 1;
+                break;
+            }
+        }
+    }
+    if (failed) {
+        perror("Failed to start the dispatcher units");
+        dispatcher_destroy(dispatcher);
+        return NULL;
+    }
+    return dispatcher;
+}
+
+long dispatcher_submit(Dispatcher *dispatcher, int model, const void *sample) {
+    if (model < 0 || model >= dispatcher->num_models) {
+        fprintf(stderr, "Invalid dispatcher model %d\n", model);
+        return -1;
+    }
+    pthread_mutex_lock(&dispatcher->lock);
+    while (dispatcher->submitted - dispatcher->retrieved == dispatcher->queue_depth) {
+        pthread_cond_wait(&dispatcher->space_free, &dispatcher->lock);
+    }
+    long sequence = dispatcher->submitted++;
+    Request *request = &dispatcher->requests[sequence % dispatcher->queue_depth];
+    request->sample = sample;
+    request->model = model;
+    request->done = 0;
+
+    ModelQueue *queue = &dispatcher->models[model];
+    queue->pending[queue->tail % dispatcher->queue_depth] = sequence;
+    queue->tail++;
+    pthread_cond_signal(&queue->work_ready);
+    pthread_mutex_unlock(&dispatcher->lock);
+    return sequence;
+}
+
+int dispatcher_result(Dispatcher *dispatcher, long *sequence, int *prediction) {
+    pthread_mutex_lock(&dispatcher->lock);
+    if (dispatcher->retrieved == dispatcher->submitted) {
+        pthread_mutex_unlock(&dispatcher->lock);
+        return -1;
+    }
+    Request *request = &dispatcher->requests[dispatcher->retrieved % dispatcher->queue_depth];
+    while (!request->done) {
+        pthread_cond_wait(&dispatcher->result_ready, &dispatcher->lock);
+    }
+    *sequence = dispatcher->retrieved++;
+    *prediction = request->prediction;
+    pthread_cond_signal(&dispatcher->space_free);
+    pthread_mutex_unlock(&dispatcher->lock);
+    return 0;
+}
+
+long dispatcher_unit_requests(const Dispatcher *dispatcher, int model, int unit) {
+    // read without the lock: only meant to be called once the results have been retrieved
+    return dispatcher->models[model].units[unit].requests;
+}
+
+void dispatcher_destroy(Dispatcher *dispatcher) {
+    if (!dispatcher) {
+        return;
+    }
+    pthread_mutex_lock(&dispatcher->lock);
+    dispatcher->shutdown = 1;
+    for (int m = 0; m < dispatcher->num_models; m++) {
+        pthread_cond_broadcast(&dispatcher->models[m].work_ready);
+    }
+    pthread_mutex_unlock(&dispatcher->lock);
+
+    for (int m = 0; m < dispatcher->num_models; m++) {
+        ModelQueue *queue = &dispatcher->models[m];
+        for (int u = 0; u < queue->started; u++) {
+            pthread_join(queue->units[u].thread, NULL);
+            free(queue->units[u].scratch);
+        }
+        free(queue->units);
+        free(queue->pending);
+        pthread_cond_destroy(&queue->work_ready);
+    }
+    pthread_mutex_destroy(&dispatcher->lock);
+    pthread_cond_destroy(&dispatcher->result_ready);
+    pthread_cond_destroy(&dispatcher->space_free);
+    free(dispatcher->requests);
+    free(dispatcher);
+}
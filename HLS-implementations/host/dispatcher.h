@@ -0,0 +1,47 @@
+#ifndef DISPATCHER_H
+#define DISPATCHER_H
+
+#include <stddef.h>
+#include "inference_pool.h"
+
+// Host-only request queue serving one or more models, each on its own set of compute units
+// (worker threads running the model's ClassifyFn).
+//
+// Requests are submitted one at a time with the model they target. Every model has a FIFO of
+// pending requests that its units drain, so a request goes to whichever unit of its model is free.
+// Results are handed back strictly in submission order, whatever unit finished first.
+// At most queue_depth requests are in flight; dispatcher_submit() waits when the queue is full.
+//
+// The sample memory of a request must stay valid until its result has been retrieved.
+
+#define DISPATCHER_MAX_MODELS 8
+
+/*------------------------ Data Structures ------------------------*/
+
+typedef struct {
+    ClassifyFn classify;         // forward pass of the model
+    int units;                   // compute units (worker threads) serving it
+    size_t scratch_size;         // scratch bytes per unit, as for the inference pool
+} DispatcherModel;
+
+typedef struct Dispatcher Dispatcher;
+
+/*-------------------------- Functions ---------------------------*/
+
+// Starts the units of num_models models (at most DISPATCHER_MAX_MODELS), NULL on failure
+Dispatcher *dispatcher_create(const DispatcherModel *models, int num_models, int queue_depth);
+
+// Queues a request for model and returns its sequence number (0, 1, 2, ... in submission order),
+// or -1 if model is not one of the models of the dispatcher
+long dispatcher_submit(Dispatcher *dispatcher, int model, const void *sample);
+
+// Waits for the oldest request not retrieved yet and stores its sequence number and prediction
+// Returns 0, or -1 if there is no request in flight.
+int dispatcher_result(Dispatcher *dispatcher, long *sequence, int *prediction);
+
+// Requests completed so far by a unit of a model, to check the load balancing
+long dispatcher_unit_requests(const Dispatcher *dispatcher, int model, int unit);
+
+void dispatcher_destroy(Dispatcher *dispatcher);
+
+#endif // DISPATCHER_H
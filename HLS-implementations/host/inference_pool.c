@@ -0,0 +1,168 @@
+#include "inference_pool.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define CACHE_LINE 64
+
+typedef struct {
+    InferencePool *pool;
+    int index;                   // worker index, selects the shard
+    void *scratch;               // private scratch area
+    pthread_t thread;
+    // padded so the per-worker results never share a cache line
+    int correct __attribute__((aligned(CACHE_LINE)));
+} Worker;
+
+struct InferencePool {
+    int num_threads;
+    ClassifyFn classify;
+    Worker *workers;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;   // a new batch (or shutdown) is available
+    pthread_cond_t work_done;    // the last worker finished its shard
+    const InferenceBatch *batch; // batch being processed
+    unsigned long generation;    // incremented for every batch
+    int pending;                 // workers still running on the current batch
+    int shutdown;
+};
+
+// Classifies the shard of the current batch assigned to this worker
+static void run_shard(Worker *worker, const InferenceBatch *batch) {
+    int num_threads = worker->pool->num_threads;
+    int start = (int)((long long)batch->count * worker->index / num_threads);
+    int end = (int)((long long)batch->count * (worker->index + 1) / num_threads);
+    const char *samples = batch->samples;
+
+    int correct = 0;
+    for (int i = start; i < end; i++) {
+        int prediction = worker->pool->classify(samples + (size_t)i * batch->sample_size, worker->scratch);
+        batch->predictions[i] = prediction;
+        if (batch->labels && prediction == batch->labels[i]) {
+            correct++;
+        }
+    }
+    worker->correct = correct;
+}
+
+static void *worker_main(void *arg) {
+    Worker *worker = arg;
+    InferencePool *pool = worker->pool;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+        seen = pool->generation;
+        const InferenceBatch *batch = pool->batch;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_shard(worker, batch);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+InferencePool *inference_pool_create(int num_threads, ClassifyFn classify, size_t scratch_size) {
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (int)cpus : 1;
+    }
+
+    InferencePool *pool = calloc(1, sizeof(InferencePool));
+    Worker *workers = aligned_alloc(CACHE_LINE, sizeof(Worker) * num_threads);
+    if (!pool || !workers) {
+        perror("Failed to allocate the inference pool");
+        free(pool);
+        free(workers);
+        return NULL;
+    }
+    pool->num_threads = num_threads;
+    pool->classify = classify;
+    pool->workers = workers;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    // round the scratch size up to whole cache lines so workers never share one
+    size_t scratch_bytes = (scratch_size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+
+    int started = 0;
+    for (; started < num_threads; started++) {
+        Worker *worker = &workers[started];
+        worker->pool = pool;
+        worker->index = started;
+        worker->correct = 0;
+        worker->scratch = scratch_bytes ? aligned_alloc(CACHE_LINE, scratch_bytes) : NULL;
+        if (scratch_bytes && !worker->scratch) {
+            perror("Failed to allocate worker scratch buffer");
+            break;
+        }
+        if (pthread_create(&worker->thread, NULL, worker_main, worker) != 0) {
+            perror("Failed to start worker thread");
+            free(worker->scratch);
+            break;
+        }
+    }
+    if (started < num_threads) {
+        pool->num_threads = started;
+        inference_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+int inference_pool_run(InferencePool *pool, const InferenceBatch *batch) {
+    pthread_mutex_lock(&pool->lock);
+    pool->batch = batch;
+    pool->pending = pool->num_threads;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pool->batch = NULL;
+    pthread_mutex_unlock(&pool->lock);
+
+    int correct = 0;
+    for (int i = 0; i < pool->num_threads; i++) {
+        correct += pool->workers[i].correct;
+    }
+    return correct;
+}
+
+int inference_pool_threads(const InferencePool *pool) {
+    return pool->num_threads;
+}
+
+void inference_pool_destroy(InferencePool *pool) {
+    if (!pool) {
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->num_threads; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+        free(pool->workers[i].scratch);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_cond_destroy(&pool->work_done);
+    free(pool->workers);
+    free(pool);
+}
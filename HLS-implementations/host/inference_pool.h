@@ -0,0 +1,40 @@
+#ifndef INFERENCE_POOL_H
+#define INFERENCE_POOL_H
+
+#include <stddef.h>
+
+// Host-only batch inference driver.
+// A fixed pool of worker threads splits every batch into one contiguous shard per worker.
+// The forward() functions keep their intermediate buffers in local variables, so each worker
+// has its own copy on its stack; the pool also gives every worker a private scratch area for
+// whatever the classify callback needs (e.g. the ConvNet class scores).
+
+/*------------------------ Data Structures ------------------------*/
+
+// Classifies one sample and returns the predicted class
+// scratch points to the calling worker's private scratch area (NULL if scratch_size is 0).
+typedef int (*ClassifyFn)(const void *sample, void *scratch);
+
+typedef struct {
+    const void *samples;         // count samples, sample_size bytes each
+    size_t sample_size;          // size of one sample in bytes
+    int count;                   // number of samples
+    const int *labels;           // true labels, or NULL to skip the accuracy count
+    int *predictions;            // receives one predicted class per sample
+} InferenceBatch;
+
+typedef struct InferencePool InferencePool;
+
+/*-------------------------- Functions ---------------------------*/
+
+// Starts num_threads workers (one per online CPU if num_threads <= 0), NULL on failure
+InferencePool *inference_pool_create(int num_threads, ClassifyFn classify, size_t scratch_size);
+
+// Classifies the whole batch and returns the number of correct predictions (0 without labels)
+int inference_pool_run(InferencePool *pool, const InferenceBatch *batch);
+
+int inference_pool_threads(const InferencePool *pool);
+
+void inference_pool_destroy(InferencePool *pool);
+
+#endif // INFERENCE_POOL_H
@@ -0,0 +1,31 @@
+#ifndef PROFILE_CLOCK_H
+#define PROFILE_CLOCK_H
+
+#include <stdint.h>
+
+// Host-only timestamps for the opt-in layer profiling of the networks (-DMLP_PROFILE, -DCONVNET_PROFILE).
+// Inline so that reading the clock around a layer costs a few cycles only.
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+#define PROFILE_CLOCK_UNIT "TSC cycles"
+
+// Time stamp counter (constant-rate CPU reference cycles)
+static inline uint64_t profile_clock(void) {
+    return __rdtsc();
+}
+#else
+#include <time.h>
+
+#define PROFILE_CLOCK_UNIT "ns"
+
+// Monotonic time in nanoseconds
+static inline uint64_t profile_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+#endif // PROFILE_CLOCK_H
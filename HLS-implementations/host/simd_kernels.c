@@ -0,0 +1,317 @@
+#include "simd_kernels.h"
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+static SimdLevel active_level;
+static pthread_once_t level_once = PTHREAD_ONCE_INIT;
+
+/*------------------------ Level selection ------------------------*/
+
+SimdLevel simd_detect(void) {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SIMD_SSE;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+static void init_level(void) {
+    active_level = simd_detect();
+}
+
+SimdLevel simd_level(void) {
+    pthread_once(&level_once, init_level);
+    return active_level;
+}
+
+SimdLevel simd_set_level(SimdLevel level) {
+    pthread_once(&level_once, init_level);
+    SimdLevel best = simd_detect();
+    active_level = level < best ? level : best;
+    return active_level;
+}
+
+const char *simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SIMD_AVX512: return "avx512";
+        case SIMD_AVX2: return "avx2";
+        case SIMD_SSE: return "sse";
+        default: return "scalar";
+    }
+}
+
+static inline float relu_if(float x, int relu) {
+    return relu && x < 0.0f ? 0.0f : x;
+}
+
+// Copies the [height][width][channels] input into zero-padded [channels][height+2][width+2] planes
+static void pad_input(const float *input, int height, int width, int channels, float *padded) {
+    int padded_width = width + 2;
+    for (int c = 0; c < channels; c++) {
+        float *plane = padded + (size_t)c * (height + 2) * padded_width;
+        for (int i = 0; i < (height + 2) * padded_width; i++) {
+            plane[i] = 0.0f;
+        }
+        for (int h = 0; h < height; h++) {
+            for (int w = 0; w < width; w++) {
+                plane[(h + 1) * padded_width + w + 1] = input[((size_t)h * width + w) * channels + c];
+            }
+        }
+    }
+}
+
+/*---------------------------- Scalar -----------------------------*/
+
+static void dense_scalar(const float *weights, const float *biases, const float *input, float *output,
+                         int n_in, int n_out, int relu) {
+    for (int j = 0; j < n_out; j++) {
+        const float *row = weights + (size_t)j * n_in;
+        float sum = biases[j];
+        for (int k = 0; k < n_in; k++) {
+            sum += row[k] * input[k];
+        }
+        output[j] = relu_if(sum, relu);
+    }
+}
+
+// Output pixels [w_start, width) of row h of output channel oc
+static void conv3x3_scalar_tail(const float *padded, int height, int width, int in_channels,
+                                const float *weights, const float *biases, int oc, int h, int w_start,
+                                float *output) {
+    int padded_width = width + 2;
+    for (int w = w_start; w < width; w++) {
+        float sum = biases[oc];
+        for (int ic = 0; ic < in_channels; ic++) {
+            const float *plane = padded + (size_t)ic * (height + 2) * padded_width;
+            const float *kernel = weights + ((size_t)oc * in_channels + ic) * 9;
+            for (int kh = 0; kh < 3; kh++) {
+                for (int kw = 0; kw < 3; kw++) {
+                    sum += plane[(h + kh) * padded_width + w + kw] * kernel[kh * 3 + kw];
+                }
+            }
+        }
+        output[((size_t)oc * height + h) * width + w] = relu_if(sum, 1);
+    }
+}
+
+static void conv3x3_scalar(const float *padded, int height, int width, int in_channels,
+                           const float *weights, const float *biases, int out_channels, float *output) {
+    for (int oc = 0; oc < out_channels; oc++) {
+        for (int h = 0; h < height; h++) {
+            conv3x3_scalar_tail(padded, height, width, in_channels, weights, biases, oc, h, 0, output);
+        }
+    }
+}
+
+#ifdef SIMD_X86
+
+/*------------------------------ SSE ------------------------------*/
+
+__attribute__((target("sse2")))
+static inline float hsum_sse(__m128 v) {
+    __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(v, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+}
+
+__attribute__((target("sse2")))
+static void dense_sse(const float *weights, const float *biases, const float *input, float *output,
+                      int n_in, int n_out, int relu) {
+    for (int j = 0; j < n_out; j++) {
+        const float *row = weights + (size_t)j * n_in;
+        __m128 acc = _mm_setzero_ps();
+        int k = 0;
+        for (; k + 4 <= n_in; k += 4) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(row + k), _mm_loadu_ps(input + k)));
+        }
+        float sum = biases[j] + hsum_sse(acc);
+        for (; k < n_in; k++) {
+            sum += row[k] * input[k];
+        }
+        output[j] = relu_if(sum, relu);
+    }
+}
+
+__attribute__((target("sse2")))
+static void conv3x3_sse(const float *padded, int height, int width, int in_channels,
+                        const float *weights, const float *biases, int out_channels, float *output) {
+    int padded_width = width + 2;
+    for (int oc = 0; oc < out_channels; oc++) {
+        for (int h = 0; h < height; h++) {
+            float *out_row = output + ((size_t)oc * height + h) * width;
+            int w = 0;
+            for (; w + 4 <= width; w += 4) {
+                __m128 acc = _mm_set1_ps(biases[oc]);
+                for (int ic = 0; ic < in_channels; ic++) {
+                    const float *plane = padded + (size_t)ic * (height + 2) * padded_width;
+                    const float *kernel = weights + ((size_t)oc * in_channels + ic) * 9;
+                    for (int kh = 0; kh < 3; kh++) {
+                        const float *in_row = plane + (h + kh) * padded_width + w;
+                        for (int kw = 0; kw < 3; kw++) {
+                            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(in_row + kw), _mm_set1_ps(kernel[kh * 3 + kw])));
+                        }
+                    }
+                }
+                _mm_storeu_ps(out_row + w, _mm_max_ps(acc, _mm_setzero_ps()));
+            }
+            conv3x3_scalar_tail(padded, height, width, in_channels, weights, biases, oc, h, w, output);
+        }
+    }
+}
+
+/*----------------------------- AVX2 ------------------------------*/
+
+__attribute__((target("avx2,fma")))
+static inline __m256i tail_mask_avx2(int n) {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+__attribute__((target("avx2,fma")))
+static inline float hsum_avx2(__m256 v) {
+    __m128 sums = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    __m128 shuf = _mm_movehdup_ps(sums);
+    sums = _mm_add_ps(sums, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    return _mm_cvtss_f32(_mm_add_ss(sums, shuf));
+}
+
+__attribute__((target("avx2,fma")))
+static void dense_avx2(const float *weights, const float *biases, const float *input, float *output,
+                       int n_in, int n_out, int relu) {
+    for (int j = 0; j < n_out; j++) {
+        const float *row = weights + (size_t)j * n_in;
+        __m256 acc = _mm256_setzero_ps();
+        int k = 0;
+        for (; k + 8 <= n_in; k += 8) {
+            acc = _mm256_fmadd_ps(_mm256_loadu_ps(row + k), _mm256_loadu_ps(input + k), acc);
+        }
+        if (k < n_in) {
+            __m256i mask = tail_mask_avx2(n_in - k);
+            acc = _mm256_fmadd_ps(_mm256_maskload_ps(row + k, mask), _mm256_maskload_ps(input + k, mask), acc);
+        }
+        output[j] = relu_if(biases[j] + hsum_avx2(acc), relu);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void conv3x3_avx2(const float *padded, int height, int width, int in_channels,
+                         const float *weights, const float *biases, int out_channels, float *output) {
+    int padded_width = width + 2;
+    for (int oc = 0; oc < out_channels; oc++) {
+        for (int h = 0; h < height; h++) {
+            float *out_row = output + ((size_t)oc * height + h) * width;
+            for (int w = 0; w < width; w += 8) {
+                // the last vector of the row is masked so it never reads past the padded plane
+                __m256i mask = tail_mask_avx2(width - w);
+                __m256 acc = _mm256_set1_ps(biases[oc]);
+                for (int ic = 0; ic < in_channels; ic++) {
+                    const float *plane = padded + (size_t)ic * (height + 2) * padded_width;
+                    const float *kernel = weights + ((size_t)oc * in_channels + ic) * 9;
+                    for (int kh = 0; kh < 3; kh++) {
+                        const float *in_row = plane + (h + kh) * padded_width + w;
+                        for (int kw = 0; kw < 3; kw++) {
+                            acc = _mm256_fmadd_ps(_mm256_maskload_ps(in_row + kw, mask),
+                                                  _mm256_set1_ps(kernel[kh * 3 + kw]), acc);
+                        }
+                    }
+                }
+                _mm256_maskstore_ps(out_row + w, mask, _mm256_max_ps(acc, _mm256_setzero_ps()));
+            }
+        }
+    }
+}
+
+/*---------------------------- AVX-512 ----------------------------*/
+
+__attribute__((target("avx512f")))
+static inline __mmask16 tail_mask_avx512(int n) {
+    return n >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << n) - 1);
+}
+
+__attribute__((target("avx512f")))
+static void dense_avx512(const float *weights, const float *biases, const float *input, float *output,
+                         int n_in, int n_out, int relu) {
+    for (int j = 0; j < n_out; j++) {
+        const float *row = weights + (size_t)j * n_in;
+        __m512 acc = _mm512_setzero_ps();
+        int k = 0;
+        for (; k + 16 <= n_in; k += 16) {
+            acc = _mm512_fmadd_ps(_mm512_loadu_ps(row + k), _mm512_loadu_ps(input + k), acc);
+        }
+        if (k < n_in) {
+            __mmask16 mask = tail_mask_avx512(n_in - k);
+            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, row + k), _mm512_maskz_loadu_ps(mask, input + k), acc);
+        }
+        output[j] = relu_if(biases[j] + _mm512_reduce_add_ps(acc), relu);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void conv3x3_avx512(const float *padded, int height, int width, int in_channels,
+                           const float *weights, const float *biases, int out_channels, float *output) {
+    int padded_width = width + 2;
+    for (int oc = 0; oc < out_channels; oc++) {
+        for (int h = 0; h < height; h++) {
+            float *out_row = output + ((size_t)oc * height + h) * width;
+            for (int w = 0; w < width; w += 16) {
+                __mmask16 mask = tail_mask_avx512(width - w);
+                __m512 acc = _mm512_set1_ps(biases[oc]);
+                for (int ic = 0; ic < in_channels; ic++) {
+                    const float *plane = padded + (size_t)ic * (height + 2) * padded_width;
+                    const float *kernel = weights + ((size_t)oc * in_channels + ic) * 9;
+                    for (int kh = 0; kh < 3; kh++) {
+                        const float *in_row = plane + (h + kh) * padded_width + w;
+                        for (int kw = 0; kw < 3; kw++) {
+                            acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, in_row + kw),
+                                                  _mm512_set1_ps(kernel[kh * 3 + kw]), acc);
+                        }
+                    }
+                }
+                _mm512_mask_storeu_ps(out_row + w, mask, _mm512_max_ps(acc, _mm512_setzero_ps()));
+            }
+        }
+    }
+}
+
+#endif // SIMD_X86
+
+/*--------------------------- Dispatch ----------------------------*/
+
+void simd_dense(const float *weights, const float *biases, const float *input, float *output,
+                int n_in, int n_out, int relu) {
+    switch (simd_level()) {
+#ifdef SIMD_X86
+        case SIMD_AVX512: dense_avx512(weights, biases, input, output, n_in, n_out, relu); return;
+        case SIMD_AVX2: dense_avx2(weights, biases, input, output, n_in, n_out, relu); return;
+        case SIMD_SSE: dense_sse(weights, biases, input, output, n_in, n_out, relu); return;
+#endif
+        default: dense_scalar(weights, biases, input, output, n_in, n_out, relu); return;
+    }
+}
+
+void simd_conv3x3_relu(const float *input, int height, int width, int in_channels,
+                       const float *weights, const float *biases, int out_channels,
+                       float *output, float *scratch) {
+    pad_input(input, height, width, in_channels, scratch);
+    switch (simd_level()) {
+#ifdef SIMD_X86
+        case SIMD_AVX512: conv3x3_avx512(scratch, height, width, in_channels, weights, biases, out_channels, output); return;
+        case SIMD_AVX2: conv3x3_avx2(scratch, height, width, in_channels, weights, biases, out_channels, output); return;
+        case SIMD_SSE: conv3x3_sse(scratch, height, width, in_channels, weights, biases, out_channels, output); return;
+#endif
+        default: conv3x3_scalar(scratch, height, width, in_channels, weights, biases, out_channels, output); return;
+    }
+}
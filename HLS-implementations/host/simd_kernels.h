@@ -0,0 +1,48 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <stddef.h>
+
+// Host-only vectorized kernels for the CPU fallback path of the networks.
+// Each kernel has AVX-512, AVX2 (+FMA), SSE and scalar versions; the best one supported by the
+// CPU is selected at run time. Results can differ from the reference forward() in the last bits
+// because of the different summation order and the fused multiply-adds.
+
+/*------------------------ Data Structures ------------------------*/
+
+typedef enum {
+    SIMD_SCALAR,                 // plain C
+    SIMD_SSE,                    // 4 lanes, SSE2
+    SIMD_AVX2,                   // 8 lanes, AVX2 + FMA
+    SIMD_AVX512                  // 16 lanes, AVX-512F
+} SimdLevel;
+
+// Scratch floats needed by simd_conv3x3_relu(): the zero-padded input planes
+#define SIMD_CONV3X3_SCRATCH(height, width, channels) ((size_t)(channels) * ((height) + 2) * ((width) + 2))
+
+/*-------------------------- Functions ---------------------------*/
+
+// Best level supported by this CPU
+SimdLevel simd_detect(void);
+
+// Level used by the kernels (simd_detect() unless overridden)
+SimdLevel simd_level(void);
+
+// Forces a level, clamped to what the CPU supports; returns the level actually selected
+SimdLevel simd_set_level(SimdLevel level);
+
+const char *simd_level_name(SimdLevel level);
+
+// Dense layer: output[j] = biases[j] + sum_k weights[j][k] * input[k], followed by ReLU if relu != 0
+// weights is row-major, n_out rows of n_in floats.
+void simd_dense(const float *weights, const float *biases, const float *input, float *output,
+                int n_in, int n_out, int relu);
+
+// 3x3 convolution, stride 1, zero padding 1, followed by ReLU
+// input is [height][width][in_channels], weights [out_channels][in_channels][3][3],
+// output [out_channels][height][width]; scratch holds SIMD_CONV3X3_SCRATCH floats.
+void simd_conv3x3_relu(const float *input, int height, int width, int in_channels,
+                       const float *weights, const float *biases, int out_channels,
+                       float *output, float *scratch);
+
+#endif // SIMD_KERNELS_H
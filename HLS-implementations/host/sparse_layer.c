@@ -0,0 +1,90 @@
+#include "sparse_layer.h"
+#include <math.h>
+#include <stdlib.h>
+
+// Weight position and magnitude, sorted to find the weights to drop
+typedef struct {
+    float magnitude;
+    int index;
+} RankedWeight;
+
+static int compare_ranked(const void *a, const void *b) {
+    const RankedWeight *x = a;
+    const RankedWeight *y = b;
+    if (x->magnitude != y->magnitude) {
+        return x->magnitude < y->magnitude ? -1 : 1;
+    }
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+int sparse_layer_prune(const float *weights, int rows, int cols, double ratio, SparseLayer *layer) {
+    int size = rows * cols;
+    SparseLayer empty = {0};
+    *layer = empty;
+
+    if (ratio < 0.0) {
+        ratio = 0.0;
+    }
+    if (ratio > 1.0) {
+        ratio = 1.0;
+    }
+    int dropped = (int)(ratio * size);
+
+    RankedWeight *ranked = malloc(sizeof(RankedWeight) * (size > 0 ? size : 1));
+    unsigned char *keep = malloc(size > 0 ? size : 1);
+    layer->row_ptr = malloc(sizeof(int) * (rows + 1));
+    layer->col_idx = malloc(sizeof(int) * (size - dropped > 0 ? size - dropped : 1));
+    layer->values = malloc(sizeof(float) * (size - dropped > 0 ? size - dropped : 1));
+    if (!ranked || !keep || !layer->row_ptr || !layer->col_idx || !layer->values) {
+        free(ranked);
+        free(keep);
+        sparse_layer_free(layer);
+        return -1;
+    }
+
+    for (int i = 0; i < size; i++) {
+        ranked[i].magnitude = fabsf(weights[i]);
+        ranked[i].index = i;
+        keep[i] = 1;
+    }
+    qsort(ranked, size, sizeof(RankedWeight), compare_ranked);
+    for (int i = 0; i < dropped; i++) {
+        keep[ranked[i].index] = 0;
+    }
+
+    layer->rows = rows;
+    layer->cols = cols;
+    for (int j = 0; j < rows; j++) {
+        layer->row_ptr[j] = layer->nnz;
+        for (int k = 0; k < cols; k++) {
+            if (keep[j * cols + k]) {
+                layer->col_idx[layer->nnz] = k;
+                layer->values[layer->nnz] = weights[j * cols + k];
+                layer->nnz++;
+            }
+        }
+    }
+    layer->row_ptr[rows] = layer->nnz;
+
+    free(ranked);
+    free(keep);
+    return 0;
+}
+
+void sparse_layer_free(SparseLayer *layer) {
+    free(layer->row_ptr);
+    free(layer->col_idx);
+    free(layer->values);
+    SparseLayer empty = {0};
+    *layer = empty;
+}
+
+void sparse_layer_forward(const SparseLayer *layer, const float *biases, const float *input, float *output, int relu) {
+    for (int j = 0; j < layer->rows; j++) {
+        float sum = biases[j];
+        for (int n = layer->row_ptr[j]; n < layer->row_ptr[j + 1]; n++) {
+            sum += layer->values[n] * input[layer->col_idx[n]];
+        }
+        output[j] = relu && !(sum > 0) ? 0 : sum;
+    }
+}
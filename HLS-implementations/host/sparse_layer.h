@@ -0,0 +1,39 @@
+#ifndef SPARSE_LAYER_H
+#define SPARSE_LAYER_H
+
+// Host-only magnitude pruning and sparse kernel for the dense (fully connected) layers.
+// A pruned layer is stored in compressed sparse row (CSR) form: the weights of output j that
+// survive the pruning are values[row_ptr[j] .. row_ptr[j + 1] - 1], with their inputs in col_idx,
+// in increasing input order. Pruned weights take neither memory nor multiply-accumulates.
+//
+// pytorch/prune_weights.py applies the same pruning rule to export the CSR tables compiled into
+// the sparse HLS top functions, so both sides keep exactly the same weights for a given ratio.
+
+/*------------------------ Data Structures ------------------------*/
+
+typedef struct {
+    int rows;                    // outputs of the layer
+    int cols;                    // inputs of the layer
+    int nnz;                     // weights kept
+    int *row_ptr;                // rows + 1 offsets into col_idx and values
+    int *col_idx;                // input of each kept weight
+    float *values;               // kept weights
+} SparseLayer;
+
+/*-------------------------- Functions ---------------------------*/
+
+// Prunes a dense layer: weights is row-major, rows outputs of cols inputs. The floor(ratio * rows * cols)
+// weights of smallest magnitude are dropped (ties broken by position, first ones dropped first), the
+// others are stored in layer. ratio is clamped to [0, 1].
+// Returns 0 on success, -1 if the memory could not be allocated (layer is then left empty).
+int sparse_layer_prune(const float *weights, int rows, int cols, double ratio, SparseLayer *layer);
+
+// Frees the arrays of a layer filled by sparse_layer_prune(); a zeroed layer is also accepted
+void sparse_layer_free(SparseLayer *layer);
+
+// Sparse dense-layer kernel: output[j] = biases[j] + sum of the kept weights[j][k] * input[k],
+// followed by ReLU if relu != 0. The products are added in increasing k, so with ratio 0 the result
+// is the same as the reference dense loop.
+void sparse_layer_forward(const SparseLayer *layer, const float *biases, const float *input, float *output, int relu);
+
+#endif // SPARSE_LAYER_H
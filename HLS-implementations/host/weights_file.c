@@ -0,0 +1,139 @@
+#include "weights_file.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static uint32_t crc_table[256];
+static pthread_once_t crc_table_once = PTHREAD_ONCE_INIT;
+
+static void init_crc_table(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320u : 0);
+        }
+        crc_table[i] = crc;
+    }
+}
+
+uint32_t weights_crc32(const void *data, size_t size) {
+    pthread_once(&crc_table_once, init_crc_table);
+
+    const uint8_t *bytes = data;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++) {
+        crc = (crc >> 8) ^ crc_table[(crc ^ bytes[i]) & 0xFF];
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static size_t tensor_size(const WeightsTensorSpec *spec) {
+    size_t count = 1;
+    for (uint32_t d = 0; d < spec->ndim; d++) {
+        count *= spec->dims[d];
+    }
+    return count * sizeof(float);
+}
+
+// Checks the mapped file against the expected tensors
+static int validate(const char *path, const uint8_t *data, size_t size,
+                    const WeightsTensorSpec *specs, int num_specs) {
+    WeightsFileHeader header;
+    if (size < sizeof(header)) {
+        fprintf(stderr, "%s: file too small for a weights header\n", path);
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    if (memcmp(header.magic, WEIGHTS_FILE_MAGIC, 4) != 0 || header.version != WEIGHTS_FILE_VERSION) {
+        fprintf(stderr, "%s: not a version %d weights file\n", path, WEIGHTS_FILE_VERSION);
+        return -1;
+    }
+    if (header.dtype != WEIGHTS_DTYPE_FLOAT32) {
+        fprintf(stderr, "%s: unsupported dtype %u\n", path, header.dtype);
+        return -1;
+    }
+    if (header.num_tensors != (uint32_t)num_specs) {
+        fprintf(stderr, "%s: %u tensors, expected %d\n", path, header.num_tensors, num_specs);
+        return -1;
+    }
+    size_t table_end = sizeof(header) + (size_t)header.num_tensors * sizeof(WeightsFileTensor);
+    if (header.payload_offset < table_end || header.payload_offset % 4 != 0 ||
+        header.payload_offset > size || header.payload_size > size - header.payload_offset) {
+        fprintf(stderr, "%s: truncated or corrupted file\n", path);
+        return -1;
+    }
+
+    uint64_t expected_offset = 0;
+    for (int i = 0; i < num_specs; i++) {
+        WeightsFileTensor tensor;
+        memcpy(&tensor, data + sizeof(header) + i * sizeof(tensor), sizeof(tensor));
+        int same_shape = tensor.ndim == specs[i].ndim;
+        for (uint32_t d = 0; same_shape && d < tensor.ndim && d < WEIGHTS_FILE_MAX_DIMS; d++) {
+            same_shape = tensor.dims[d] == specs[i].dims[d];
+        }
+        if (strncmp(tensor.name, specs[i].name, WEIGHTS_FILE_NAME_SIZE) != 0 || !same_shape ||
+            tensor.offset != expected_offset) {
+            fprintf(stderr, "%s: tensor %d (%.*s) does not match %s of the compiled network\n",
+                    path, i, WEIGHTS_FILE_NAME_SIZE, tensor.name, specs[i].name);
+            return -1;
+        }
+        expected_offset += tensor_size(&specs[i]);
+    }
+    if (header.payload_size != expected_offset) {
+        fprintf(stderr, "%s: payload is %llu bytes, expected %llu\n", path,
+                (unsigned long long)header.payload_size, (unsigned long long)expected_offset);
+        return -1;
+    }
+    if (weights_crc32(data + header.payload_offset, header.payload_size) != header.checksum) {
+        fprintf(stderr, "%s: checksum mismatch\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+int weights_file_open(const char *path, const WeightsTensorSpec *specs, int num_specs, WeightsFile *file) {
+    memset(file, 0, sizeof(*file));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror("Failed to open weights file");
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        fprintf(stderr, "%s: empty or unreadable file\n", path);
+        close(fd);
+        return -1;
+    }
+    void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror("Failed to map weights file");
+        return -1;
+    }
+
+    if (validate(path, map, (size_t)st.st_size, specs, num_specs) != 0) {
+        munmap(map, (size_t)st.st_size);
+        return -1;
+    }
+
+    WeightsFileHeader header;
+    memcpy(&header, map, sizeof(header));
+    file->map = map;
+    file->map_size = (size_t)st.st_size;
+    file->payload = (const uint8_t *)map + header.payload_offset;
+    file->payload_size = header.payload_size;
+    return 0;
+}
+
+void weights_file_close(WeightsFile *file) {
+    if (file->map) {
+        munmap(file->map, file->map_size);
+    }
+    memset(file, 0, sizeof(*file));
+}
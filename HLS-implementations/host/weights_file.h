@@ -0,0 +1,71 @@
+#ifndef WEIGHTS_FILE_H
+#define WEIGHTS_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host-only reader of the binary weight container written by pytorch/export_weights_bin.py.
+//
+// Layout (little-endian):
+//   WeightsFileHeader                      32 bytes
+//   WeightsFileTensor[num_tensors]         64 bytes each
+//   zero padding up to payload_offset      (64-byte aligned)
+//   payload                                the tensors back to back, float32
+//
+// The payload has the same layout as the network structure (MLP, ConvNet), so the file is
+// memory-mapped and used in place, without copying or parsing the values.
+
+#define WEIGHTS_FILE_MAGIC "NNWB"
+#define WEIGHTS_FILE_VERSION 1
+#define WEIGHTS_FILE_MAX_DIMS 4
+#define WEIGHTS_FILE_NAME_SIZE 32
+
+/*------------------------ Data Structures ------------------------*/
+
+typedef enum {
+    WEIGHTS_DTYPE_FLOAT32 = 0
+} WeightsDtype;
+
+typedef struct {
+    char magic[4];               // WEIGHTS_FILE_MAGIC
+    uint32_t version;            // WEIGHTS_FILE_VERSION
+    uint32_t dtype;              // WeightsDtype of every tensor
+    uint32_t num_tensors;        // number of tensor descriptors
+    uint32_t checksum;           // CRC-32 (zlib) of the payload
+    uint32_t payload_offset;     // payload position from the start of the file
+    uint64_t payload_size;       // payload size in bytes
+} WeightsFileHeader;
+
+typedef struct {
+    char name[WEIGHTS_FILE_NAME_SIZE];    // PyTorch parameter name, e.g. "fc1.weight"
+    uint32_t ndim;                        // number of dimensions
+    uint32_t dims[WEIGHTS_FILE_MAX_DIMS]; // shape, unused dimensions are 0
+    uint32_t reserved;
+    uint64_t offset;                      // position inside the payload
+} WeightsFileTensor;
+
+// Shape a tensor must have, used to validate a file against the compiled network
+typedef struct {
+    const char *name;
+    uint32_t ndim;
+    uint32_t dims[WEIGHTS_FILE_MAX_DIMS];
+} WeightsTensorSpec;
+
+typedef struct {
+    void *map;                   // whole file mapping
+    size_t map_size;
+    const void *payload;         // points into the mapping
+    size_t payload_size;
+} WeightsFile;
+
+/*-------------------------- Functions ---------------------------*/
+
+// Maps path and checks header, checksum and that its tensors match specs (same order, same
+// shapes, stored back to back). Returns 0 on success, -1 with a message on stderr otherwise.
+int weights_file_open(const char *path, const WeightsTensorSpec *specs, int num_specs, WeightsFile *file);
+
+void weights_file_close(WeightsFile *file);
+
+uint32_t weights_crc32(const void *data, size_t size);
+
+#endif // WEIGHTS_FILE_H
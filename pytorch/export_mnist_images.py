@@ -0,0 +1,37 @@
+# Writes MNIST test images in the text format of input_image.txt, one after the other, so the
+# ConvNet testbench can evaluate the network on many images:
+#
+#   Label: <n>
+#   {v,v,...,v},        28 rows of 28 normalized pixel values
+#
+# The images are normalized like in mnist_convnet.ipynb.
+#
+# Usage: python export_mnist_images.py [count] [output]   (run from the pytorch folder)
+#        defaults: the whole test set (10000 images), mnist_test_images.txt
+
+import sys
+
+import torchvision
+
+count = int(sys.argv[1]) if len(sys.argv) > 1 else None
+output = sys.argv[2] if len(sys.argv) > 2 else 'mnist_test_images.txt'
+
+test_dataset = torchvision.datasets.MNIST(
+    "./data",
+    train=False,
+    download=True,
+    transform=torchvision.transforms.Compose([
+        torchvision.transforms.ToTensor(),
+        torchvision.transforms.Normalize((0.5,), (0.5,))
+    ])
+)
+
+count = len(test_dataset) if count is None else min(count, len(test_dataset))
+with open(output, 'w') as f:
+    for i in range(count):
+        image, label = test_dataset[i]
+        f.write(f"Label: {label}\n")
+        for row in image.squeeze().numpy():
+            f.write("{")
+            f.write(",".join(map(str, row)) + "},\n")
+print(f"Wrote {count} images to {output}")
@@ -0,0 +1,61 @@
+# Converts the weight dumps into the binary weight container loaded at run time by the C models
+# (see HLS-implementations/host/weights_file.h for the layout).
+#
+# The payload stores the tensors back to back as little-endian float32, in the same order as the
+# fields of the MLP / ConvNet structures, so the host can use the memory-mapped payload directly
+# and the FPGA can burst-read it into its on-chip weight memories.
+#
+# Usage: python export_weights_bin.py   (run from the pytorch folder)
+#        python export_weights_bin.py <dump.txt> <output.bin>
+#            exports every tensor of a dump in file order, e.g. for another MLP model descriptor
+
+import struct
+import sys
+import zlib
+
+from weights_txt import load_weights
+
+MAGIC = b'NNWB'
+VERSION = 1
+DTYPE_FLOAT32 = 0
+MAX_DIMS = 4
+NAME_SIZE = 32
+HEADER_SIZE = 32
+TENSOR_ENTRY_SIZE = NAME_SIZE + 4 + 4 * MAX_DIMS + 4 + 8
+PAYLOAD_ALIGNMENT = 64
+
+
+def export(source, destination, tensor_names=None):
+    tensors = load_weights(source)
+    if tensor_names is None:
+        tensor_names = list(tensors)
+    payload = b''
+    entries = b''
+    for name in tensor_names:
+        shape, values = tensors[name]
+        dims = list(shape) + [0] * (MAX_DIMS - len(shape))
+        entries += struct.pack(f'<{NAME_SIZE}sI{MAX_DIMS}IIQ', name.encode(), len(shape), *dims, 0, len(payload))
+        payload += struct.pack(f'<{len(values)}f', *values)
+
+    payload_offset = HEADER_SIZE + len(entries)
+    payload_offset = (payload_offset + PAYLOAD_ALIGNMENT - 1) // PAYLOAD_ALIGNMENT * PAYLOAD_ALIGNMENT
+    header = struct.pack('<4sIIIIIQ', MAGIC, VERSION, DTYPE_FLOAT32, len(tensor_names),
+                         zlib.crc32(payload), payload_offset, len(payload))
+    assert len(header) == HEADER_SIZE and len(entries) == TENSOR_ENTRY_SIZE * len(tensor_names)
+
+    with open(destination, 'wb') as f:
+        f.write(header)
+        f.write(entries)
+        f.write(b'\0' * (payload_offset - HEADER_SIZE - len(entries)))
+        f.write(payload)
+    print(f"{destination}: {len(tensor_names)} tensors, {len(payload)} payload bytes")
+
+
+if __name__ == '__main__':
+    if len(sys.argv) == 3:
+        export(sys.argv[1], sys.argv[2])
+        sys.exit()
+    export('mlp_weights.txt', 'mlp_weights.bin',
+           ['fc1.weight', 'fc1.bias', 'fc2.weight', 'fc2.bias', 'fc3.weight', 'fc3.bias'])
+    export('convnet_weights.txt', 'convnet_weights.bin',
+           ['conv1.weight', 'conv1.bias', 'fc1.weight', 'fc1.bias'])
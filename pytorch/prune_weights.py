@@ -0,0 +1,96 @@
+# Magnitude-prunes the fully connected layers and writes their compressed sparse row (CSR) tables
+# as C headers for the sparse inference paths (forward_batch_sparse() in MLP.c, forward_sparse()
+# in ConvNet.c).
+#
+# In every layer the floor(ratio * size) weights of smallest magnitude are dropped, ties broken by
+# position, the same rule as sparse_layer_prune() in HLS-implementations/host/sparse_layer.c: the
+# testbenches check the exported tables against the host sparse kernel and print the accuracy of
+# a range of ratios, to pick the ones exported here.
+#
+# Usage: python prune_weights.py [mlp_ratio convnet_ratio]   (run from the pytorch folder)
+
+import struct
+import sys
+
+from weights_txt import load_weights
+
+# Default pruning ratios. The MLP one comes from the report of its testbench on the 150 iris
+# samples. No MNIST test set ships with the repository, so the ConvNet report only covers the
+# single image of input_image.txt and does not back the ConvNet ratio: 0.3 just matches the MLP.
+# Run the ConvNet testbench on an export_mnist_images.py file to choose it.
+MLP_RATIO = 0.3
+CONVNET_RATIO = 0.3
+
+
+def float32(value):
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+
+def prune_layer(weights, rows, cols, ratio):
+    """Returns the CSR arrays (row_ptr, col_idx, values) of the weights kept at ratio."""
+    ratio = min(max(ratio, 0.0), 1.0)
+    size = rows * cols
+    dropped = int(ratio * size)
+    ranked = sorted(range(size), key=lambda i: (abs(float32(weights[i])), i))
+    keep = [True] * size
+    for i in ranked[:dropped]:
+        keep[i] = False
+
+    row_ptr, col_idx, values = [0], [], []
+    for j in range(rows):
+        for k in range(cols):
+            if keep[j * cols + k]:
+                col_idx.append(k)
+                values.append(weights[j * cols + k])
+        row_ptr.append(len(values))
+    return row_ptr, col_idx, values
+
+
+def c_list(values, fmt, per_line, indent):
+    items = [format(v, fmt) for v in values]
+    lines = [", ".join(items[i:i + per_line]) for i in range(0, len(items), per_line)]
+    return (",\n" + indent).join(lines)
+
+
+def write_header(path, source, guard, prefix, macro_prefix, ratio, layers):
+    with open(path, 'w') as f:
+        f.write(f"// Generated by pytorch/prune_weights.py from pytorch/{source}, do not edit.\n")
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write(f"// Fully connected layers pruned to ratio {ratio:g}, in CSR form: the kept weights of output j\n")
+        f.write("// are values[row_ptr[j] .. row_ptr[j + 1] - 1], at inputs col_idx[...]\n")
+        f.write(f"const double {prefix}_sparse_ratio = {ratio!r};\n\n")
+        for name, rows, cols, (row_ptr, col_idx, values) in layers:
+            macro = f"{macro_prefix}SPARSE_{name.upper()}_NNZ"
+            f.write(f"// {name}: {len(values)} of {rows * cols} weights kept\n")
+            f.write(f"#define {macro} {len(values)}\n")
+            f.write(f"const int {prefix}_sparse_{name}_row_ptr[{rows + 1}] = {{{', '.join(str(p) for p in row_ptr)}}};\n")
+            index_type = 'uint8_t' if cols <= 256 else 'uint16_t'
+            f.write(f"const {index_type} {prefix}_sparse_{name}_col_idx[{macro}] = {{\n    "
+                    f"{c_list(col_idx, 'd', 32, '    ')}\n}};\n")
+            f.write(f"const float {prefix}_sparse_{name}_values[{macro}] = {{\n    "
+                    f"{c_list(values, '.9g', 8, '    ')}\n}};\n\n")
+        f.write(f"#endif // {guard}\n")
+
+
+def prune_model(source, layer_names, ratio):
+    tensors = load_weights(source)
+    layers = []
+    for name in layer_names:
+        (rows, cols), weights = tensors[name + '.weight']
+        csr = prune_layer(weights, rows, cols, ratio)
+        layers.append((name, rows, cols, csr))
+        print(f"{source} {name}: ratio {ratio:g}, {len(csr[2])}/{rows * cols} weights kept")
+    return layers
+
+
+if __name__ == '__main__':
+    mlp_ratio = float(sys.argv[1]) if len(sys.argv) > 1 else MLP_RATIO
+    convnet_ratio = float(sys.argv[2]) if len(sys.argv) > 2 else CONVNET_RATIO
+
+    mlp_layers = prune_model('mlp_weights.txt', ['fc1', 'fc2', 'fc3'], mlp_ratio)
+    write_header('../HLS-implementations/MLP/MLP_sparse_weights.h', 'mlp_weights.txt',
+                 'MLP_SPARSE_WEIGHTS_H', 'mlp', 'MLP_', mlp_ratio, mlp_layers)
+
+    convnet_layers = prune_model('convnet_weights.txt', ['fc1'], convnet_ratio)
+    write_header('../HLS-implementations/ConvNet/ConvNet_sparse_weights.h', 'convnet_weights.txt',
+                 'CONVNET_SPARSE_WEIGHTS_H', 'convnet', 'CONVNET_', convnet_ratio, convnet_layers)
@@ -0,0 +1,82 @@
+# Converts the float weight dumps into int8 tables with one scale per layer and writes them as
+# C headers for the quantized inference path (MLP_quantized.c / ConvNet_quantized.c).
+#
+#   weights:      int8, symmetric, real = q * scale with scale = max|w| / 127
+#   biases:       int32, already in accumulator units (real = q * scale / 2^ACT_FRAC_BITS)
+#   activations:  int16 fixed point with ACT_FRAC_BITS fractional bits
+#
+# The float scale is also emitted as an integer multiplier/shift pair so the kernels can
+# requantize the accumulators without any floating-point hardware.
+#
+# Usage: python quantize_weights.py   (run from the pytorch folder)
+
+from weights_txt import load_weights
+
+ACT_FRAC_BITS = 8       # must match Q_ACT_FRAC_BITS in MLP.h / ConvNet.h
+MULT_BITS = 15          # width of the requantization multiplier
+
+
+def quantize_layer(weights, biases):
+    w_max = max(abs(w) for w in weights)
+    scale = w_max / 127.0
+    q_weights = [max(-127, min(127, round(w / scale))) for w in weights]
+    q_biases = [round(b / scale * (1 << ACT_FRAC_BITS)) for b in biases]
+
+    # scale ~= mult / 2^shift, with mult using MULT_BITS bits
+    shift = 0
+    while round(scale * (1 << (shift + 1))) < (1 << MULT_BITS):
+        shift += 1
+    mult = round(scale * (1 << shift))
+    return scale, mult, shift, q_weights, q_biases
+
+
+def c_rows(values, row_len, indent):
+    rows = [values[i:i + row_len] for i in range(0, len(values), row_len)]
+    return (",\n" + indent).join("{" + ", ".join(str(v) for v in row) + "}" for row in rows)
+
+
+def write_header(path, source, guard, struct_type, var_name, layers):
+    with open(path, 'w') as f:
+        f.write(f"// Generated by pytorch/quantize_weights.py from pytorch/{source}, do not edit.\n")
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write("// Per-layer weight scales: real weight = q * SCALE, SCALE ~= MULT / 2^SHIFT\n")
+        for macro, _, scale, mult, shift, _, _, _ in layers:
+            f.write(f"#define Q_{macro}_SCALE {scale:.9g}f\n")
+            f.write(f"#define Q_{macro}_MULT {mult}\n")
+            f.write(f"#define Q_{macro}_SHIFT {shift}\n")
+        f.write("\n")
+
+        f.write(f"const {struct_type} {var_name} = {{\n")
+        for i, (_, field, _, _, _, q_weights, q_biases, row_len) in enumerate(layers):
+            f.write(f"    .{field} = {{\n")
+            f.write(f"        .weights = {{\n            {c_rows(q_weights, row_len, '            ')}\n        }},\n")
+            f.write(f"        .biases = {{{', '.join(str(b) for b in q_biases)}}}\n")
+            f.write("    }" + ("," if i < len(layers) - 1 else "") + "\n")
+        f.write("};\n\n")
+        f.write(f"#endif // {guard}\n")
+
+
+def quantize_model(source, layer_names, row_lengths):
+    tensors = load_weights(source)
+    layers = []
+    for (macro, field, prefix), row_len in zip(layer_names, row_lengths):
+        weights = tensors[prefix + '.weight'][1]
+        biases = tensors[prefix + '.bias'][1]
+        scale, mult, shift, q_weights, q_biases = quantize_layer(weights, biases)
+        layers.append((macro, field, scale, mult, shift, q_weights, q_biases, row_len))
+        print(f"{source} {prefix}: scale={scale:.6g} mult={mult} shift={shift}")
+    return layers
+
+
+if __name__ == '__main__':
+    mlp_layers = quantize_model('mlp_weights.txt',
+                                [('FC1', 'fc1', 'fc1'), ('FC2', 'fc2', 'fc2'), ('FC3', 'fc3', 'fc3')],
+                                [4, 10, 10])
+    write_header('../HLS-implementations/MLP/MLP_quantized_weights.h', 'mlp_weights.txt',
+                 'MLP_QUANTIZED_WEIGHTS_H', 'QuantizedMLP', 'mlp_quantized', mlp_layers)
+
+    convnet_layers = quantize_model('convnet_weights.txt',
+                                    [('CONV1', 'conv1', 'conv1'), ('FC1', 'fc1', 'fc1')],
+                                    [9, 588])
+    write_header('../HLS-implementations/ConvNet/ConvNet_quantized_weights.h', 'convnet_weights.txt',
+                 'CONVNET_QUANTIZED_WEIGHTS_H', 'QuantizedConvNet', 'convnet_quantized', convnet_layers)
@@ -0,0 +1,36 @@
+# Parser for the weight dumps written by the training notebooks (mlp_weights.txt, convnet_weights.txt).
+# Each tensor starts with a "[// ]<name>, shape: (d0, d1, ...)" line followed by its values
+# as brace-enclosed, comma-separated rows.
+
+import re
+from collections import OrderedDict
+
+HEADER = re.compile(r'^\s*(?://\s*)?([\w.]+), shape: \(([\d,\s]*)\)')
+NUMBER = re.compile(r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+
+
+def load_weights(path):
+    """Returns an ordered dict: tensor name -> (shape tuple, flat list of floats)."""
+    tensors = OrderedDict()
+    name = None
+    with open(path) as f:
+        for line in f:
+            header = HEADER.match(line)
+            if header:
+                name = header.group(1)
+                shape = tuple(int(d) for d in header.group(2).split(',') if d.strip())
+                tensors[name] = (shape, [])
+                continue
+            if name is None:
+                continue
+            # drop trailing comments such as "// Output Channel 0"
+            values = line.split('//')[0]
+            tensors[name][1].extend(float(v) for v in NUMBER.findall(values))
+
+    for name, (shape, values) in tensors.items():
+        expected = 1
+        for d in shape:
+            expected *= d
+        if len(values) != expected:
+            raise ValueError(f"{path}: {name} has {len(values)} values, expected {expected} for shape {shape}")
+    return tensors